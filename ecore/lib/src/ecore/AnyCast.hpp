@@ -16,6 +16,8 @@
 #include "ecore/SmartPtr.hpp"
 #include "ecore/impl/BasicEList.hpp"
 
+#include <vector>
+
 namespace ecore
 {
     template <typename T>
@@ -120,6 +122,20 @@ namespace ecore
         return nullptr;
     }
 
+    // Returns the values held by any : a vector of values or a list, as notified by ADD_MANY and REMOVE_MANY
+    inline std::vector<Any> anyValuesCast( const Any& any )
+    {
+        if( auto values = _anyCast<std::vector<Any>>( &any ) )
+            return *values;
+
+        std::vector<Any> result;
+        if( auto l = _anyCast<std::shared_ptr<EList<std::shared_ptr<EObject>>>>( &any ) )
+            result.assign( ( *l )->begin(), ( *l )->end() );
+        else if( auto l = _anyCast<std::shared_ptr<EList<Any>>>( &any ) )
+            result.assign( ( *l )->begin(), ( *l )->end() );
+        return result;
+    }
+
 } // namespace ecore
 
 #endif /* ECORE_ANYCAST_HPP_ */
@@ -0,0 +1,520 @@
+#include "ecore/EChangeRecorder.hpp"
+#include "ecore/AnyCast.hpp"
+#include "ecore/EClass.hpp"
+#include "ecore/EDataType.hpp"
+#include "ecore/EFactory.hpp"
+#include "ecore/EList.hpp"
+#include "ecore/ENotification.hpp"
+#include "ecore/EObject.hpp"
+#include "ecore/EPackage.hpp"
+#include "ecore/EReference.hpp"
+#include "ecore/EResource.hpp"
+#include "ecore/EResourceSet.hpp"
+#include "ecore/EStructuralFeature.hpp"
+#include "ecore/EcoreUtils.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <ostream>
+
+using namespace ecore;
+using namespace ecore::impl;
+
+namespace
+{
+    constexpr std::uint32_t NO_POSITION = std::numeric_limits<std::uint32_t>::max();
+
+    const char* eventNames[] = { "CREATE", "SET", "UNSET", "ADD", "REMOVE", "ADD_MANY", "REMOVE_MANY", "MOVE", "REMOVING_ADAPTER", "RESOLVE" };
+
+    std::shared_ptr<EList<Any>> toList( const Any& value )
+    {
+        if( auto l = _anyCast<std::shared_ptr<EList<std::shared_ptr<EObject>>>>( &value ) )
+            return ( *l )->asEListOf<Any>();
+        if( auto l = _anyCast<std::shared_ptr<EList<Any>>>( &value ) )
+            return *l;
+        return nullptr;
+    }
+
+    // a value being added may already be in a unique list when the changes of both sides of a move are replayed
+    void ensureAdded( EList<Any>& list, const Any& value, std::size_t position, bool isUnique )
+    {
+        if( isUnique )
+        {
+            auto index = list.indexOf( value );
+            if( index != ENotification::NO_INDEX )
+            {
+                if( position < list.size() && position != index )
+                    list.move( position, index );
+                return;
+            }
+        }
+        list.add( std::min( position, list.size() ), value );
+    }
+
+    void ensureRemoved( EList<Any>& list, const Any& value, std::size_t position )
+    {
+        if( position < list.size() && list.get( position ) == value )
+            list.remove( position );
+        else
+        {
+            auto index = list.indexOf( value );
+            if( index != ENotification::NO_INDEX )
+                list.remove( index );
+        }
+    }
+
+    // a change of a bidirectional reference is notified on both sides but replaying one side updates the other :
+    // the containment side, the single valued side or, by default, the first side by name is the change and the
+    // other side is only kept to restore the positions of its list
+    bool isOppositeSide( const std::shared_ptr<EStructuralFeature>& feature )
+    {
+        auto eReference = std::dynamic_pointer_cast<EReference>( feature );
+        if( !eReference || eReference->isContainment() )
+            return false;
+        auto eOpposite = eReference->getEOpposite();
+        if( !eOpposite )
+            return false;
+        if( eReference->isMany() != eOpposite->isMany() )
+            return eReference->isMany();
+        return !( eReference->getName() < eOpposite->getName()
+                  || ( eReference->getName() == eOpposite->getName() && eReference < eOpposite ) );
+    }
+
+    void writeString( std::ostream& os, const std::string& s )
+    {
+        for( auto c : s )
+        {
+            switch( c )
+            {
+            case '\\':
+                os << "\\\\";
+                break;
+            case '\t':
+                os << "\\t";
+                break;
+            case '\n':
+                os << "\\n";
+                break;
+            default:
+                os << c;
+                break;
+            }
+        }
+    }
+} // namespace
+
+void EChangeRecorder::notifyChanged( const std::shared_ptr<ENotification>& notification )
+{
+    EContentAdapter::notifyChanged( notification );
+    if( !isReplaying_ && isRecorded( notification ) )
+        record( notification );
+    updateUnset( notification );
+}
+
+void EChangeRecorder::setTarget( const std::shared_ptr<ENotifier>& target )
+{
+    EContentAdapter::setTarget( target );
+
+    // the notifications of unsettable features don't tell if they were set : their state is kept from the adaptation
+    auto eObject = std::dynamic_pointer_cast<EObject>( target );
+    if( !eObject )
+        return;
+
+    std::vector<int> featureIDs;
+    auto eClass = eObject->eClass();
+    for( int featureID = 0; featureID < eClass->getFeatureCount(); ++featureID )
+    {
+        auto feature = eClass->getEStructuralFeature( featureID );
+        if( feature->isUnsettable() && !feature->isMany() && !eObject->eIsSet( feature ) )
+            featureIDs.push_back( featureID );
+    }
+    if( featureIDs.empty() )
+        unsetFeatures_.erase( eObject.get() );
+    else
+        unsetFeatures_[eObject.get()] = std::move( featureIDs );
+}
+
+void EChangeRecorder::unsetTarget( const std::shared_ptr<ENotifier>& target )
+{
+    EContentAdapter::unsetTarget( target );
+    if( auto eObject = std::dynamic_pointer_cast<EObject>( target ) )
+        unsetFeatures_.erase( eObject.get() );
+}
+
+std::size_t EChangeRecorder::getChangeCount() const
+{
+    return changes_.size() - oppositeCount_;
+}
+
+void EChangeRecorder::clear()
+{
+    changes_.clear();
+    notifiers_.clear();
+    notifierIndexes_.clear();
+    values_.resize( 1 );
+    objectIndexes_.clear();
+    oppositeCount_ = 0;
+    isRolledBack_ = false;
+}
+
+void EChangeRecorder::rollback()
+{
+    if( isRolledBack_ )
+        return;
+
+    isReplaying_ = true;
+    for( auto it = changes_.rbegin(); it != changes_.rend(); ++it )
+        revert( *it );
+    isReplaying_ = false;
+    isRolledBack_ = true;
+}
+
+void EChangeRecorder::apply()
+{
+    if( !isRolledBack_ )
+        return;
+
+    isReplaying_ = true;
+    for( const auto& change : changes_ )
+        replay( change );
+    isReplaying_ = false;
+    isRolledBack_ = false;
+}
+
+void EChangeRecorder::save( std::ostream& os ) const
+{
+    for( const auto& change : changes_ )
+    {
+        if( change.isOpposite_ )
+            continue;
+
+        const auto& notifier = notifiers_[change.notifier_];
+        os << eventNames[change.eventType_] << '\t';
+        if( auto eObject = std::dynamic_pointer_cast<EObject>( notifier ) )
+            os << EcoreUtils::getURI( eObject ).toString() << '\t' << getFeature( change )->getName();
+        else if( auto eResource = std::dynamic_pointer_cast<EResource>( notifier ) )
+            os << eResource->getURI().toString() << '\t' << "contents";
+        else
+            os << '\t' << "resources";
+        os << '\t';
+        if( change.position_ != NO_POSITION )
+            os << change.position_;
+        os << '\t';
+        writeValue( os, change, values_[change.oldValue_] );
+        os << '\t';
+        writeValue( os, change, values_[change.newValue_] );
+        os << '\n';
+    }
+}
+
+bool EChangeRecorder::isRecorded( const std::shared_ptr<ENotification>& notification ) const
+{
+    switch( notification->getEventType() )
+    {
+    case ENotification::SET:
+    case ENotification::ADD:
+    case ENotification::REMOVE:
+    case ENotification::ADD_MANY:
+    case ENotification::REMOVE_MANY:
+    case ENotification::MOVE:
+        break;
+    case ENotification::UNSET:
+        // unsettable lists notify their unset with booleans : their contents changes are notified apart
+        if( notification->getOldValue().type() == typeid( bool ) )
+            return false;
+        break;
+    default:
+        return false;
+    }
+
+    auto feature = notification->getFeature();
+    if( !feature )
+    {
+        // resources and resource sets have no meta model : their contents are identified by feature id
+        auto notifier = notification->getNotifier();
+        auto featureID = notification->getFeatureID();
+        return ( featureID == EResource::RESOURCE__CONTENTS && std::dynamic_pointer_cast<EResource>( notifier ) )
+               || ( featureID == EResourceSet::RESOURCE_SET__RESOURCES && std::dynamic_pointer_cast<EResourceSet>( notifier ) );
+    }
+
+    // the container side is restored with the containment list
+    auto eReference = std::dynamic_pointer_cast<EReference>( feature );
+    return !eReference || !eReference->isContainer();
+}
+
+void EChangeRecorder::record( const std::shared_ptr<ENotification>& notification )
+{
+    // changes recorded after a rollback replace the reverted ones
+    if( isRolledBack_ )
+        clear();
+
+    auto notifier = addNotifier( notification->getNotifier() );
+    auto featureID = notification->getFeatureID();
+    auto eventType = notification->getEventType();
+    auto position = notification->getPosition();
+    auto compactPosition = position == ENotification::NO_INDEX ? NO_POSITION : static_cast<std::uint32_t>( position );
+
+    // successive sets of a single valued feature are merged : the first old value and the last new value are kept
+    if( eventType == ENotification::SET && compactPosition == NO_POSITION && !changes_.empty() )
+    {
+        auto& last = changes_.back();
+        if( last.eventType_ == ENotification::SET && last.notifier_ == notifier && last.featureID_ == featureID
+            && last.position_ == NO_POSITION )
+        {
+            last.newValue_ = addValue( notification->getNewValue() );
+            return;
+        }
+    }
+
+    Change change;
+    change.notifier_ = notifier;
+    change.featureID_ = featureID;
+    change.position_ = compactPosition;
+    change.eventType_ = static_cast<std::uint8_t>( eventType );
+    // a move in a list doesn't change the other side
+    change.isOpposite_ = eventType != ENotification::MOVE && isOppositeSide( notification->getFeature() );
+    if( change.isOpposite_ )
+        ++oppositeCount_;
+    // a dynamic feature which was not set notifies an empty old value
+    change.wasSet_ = eventType != ENotification::SET || compactPosition != NO_POSITION
+                     || ( !notification->getOldValue().empty()
+                          && !isUnset( dynamic_cast<EObject*>( notification->getNotifier().get() ), featureID ) );
+    if( eventType == ENotification::ADD_MANY || eventType == ENotification::REMOVE_MANY )
+    {
+        change.oldValue_ = notification->getOldValue().empty() ? 0 : addValue( anyValuesCast( notification->getOldValue() ) );
+        change.newValue_ = notification->getNewValue().empty() ? 0 : addValue( anyValuesCast( notification->getNewValue() ) );
+    }
+    else
+    {
+        change.oldValue_ = addValue( notification->getOldValue() );
+        change.newValue_ = addValue( notification->getNewValue() );
+    }
+    changes_.push_back( change );
+}
+
+std::uint32_t EChangeRecorder::addNotifier( const std::shared_ptr<ENotifier>& notifier )
+{
+    auto [it, inserted] = notifierIndexes_.emplace( notifier.get(), static_cast<std::uint32_t>( notifiers_.size() ) );
+    if( inserted )
+        notifiers_.push_back( notifier );
+    return it->second;
+}
+
+std::uint32_t EChangeRecorder::addValue( const Any& value )
+{
+    if( value.empty() )
+        return 0;
+
+    if( auto eObject = _anyCast<std::shared_ptr<EObject>>( &value ) )
+    {
+        auto [it, inserted] = objectIndexes_.emplace( eObject->get(), static_cast<std::uint32_t>( values_.size() ) );
+        if( inserted )
+            values_.push_back( value );
+        return it->second;
+    }
+
+    values_.push_back( value );
+    return static_cast<std::uint32_t>( values_.size() - 1 );
+}
+
+bool EChangeRecorder::isUnset( EObject* eObject, int featureID ) const
+{
+    auto it = unsetFeatures_.find( eObject );
+    return it != unsetFeatures_.end() && std::find( it->second.begin(), it->second.end(), featureID ) != it->second.end();
+}
+
+void EChangeRecorder::updateUnset( const std::shared_ptr<ENotification>& notification )
+{
+    auto eventType = notification->getEventType();
+    auto feature = notification->getFeature();
+    if( ( eventType != ENotification::SET && eventType != ENotification::UNSET ) || !feature || !feature->isUnsettable()
+        || feature->isMany() )
+        return;
+
+    auto eObject = std::static_pointer_cast<EObject>( notification->getNotifier() );
+    auto featureID = notification->getFeatureID();
+    if( eventType == ENotification::UNSET )
+    {
+        if( !isUnset( eObject.get(), featureID ) )
+            unsetFeatures_[eObject.get()].push_back( featureID );
+    }
+    else if( auto it = unsetFeatures_.find( eObject.get() ); it != unsetFeatures_.end() )
+    {
+        auto& featureIDs = it->second;
+        featureIDs.erase( std::remove( featureIDs.begin(), featureIDs.end(), featureID ), featureIDs.end() );
+        if( featureIDs.empty() )
+            unsetFeatures_.erase( it );
+    }
+}
+
+void EChangeRecorder::revert( const Change& change )
+{
+    const auto& oldValue = values_[change.oldValue_];
+    const auto& newValue = values_[change.newValue_];
+    std::size_t position = change.position_ == NO_POSITION ? ENotification::NO_INDEX : change.position_;
+    switch( change.eventType_ )
+    {
+    case ENotification::SET:
+    case ENotification::UNSET:
+    {
+        if( position != ENotification::NO_INDEX )
+            getList( change )->set( position, oldValue );
+        else
+        {
+            auto eObject = std::static_pointer_cast<EObject>( notifiers_[change.notifier_] );
+            if( change.wasSet_ )
+                eObject->eSet( getFeature( change ), oldValue );
+            else
+                eObject->eUnset( getFeature( change ) );
+        }
+        break;
+    }
+    case ENotification::ADD:
+    {
+        ensureRemoved( *getList( change ), newValue, position );
+        break;
+    }
+    case ENotification::ADD_MANY:
+    {
+        auto list = getList( change );
+        const auto& values = anyCast<const std::vector<Any>&>( newValue );
+        for( auto i = values.size(); i > 0; --i )
+            ensureRemoved( *list, values[i - 1], position + i - 1 );
+        break;
+    }
+    case ENotification::REMOVE:
+    {
+        auto feature = getFeature( change );
+        ensureAdded( *getList( change ), oldValue, position, !feature || feature->isUnique() );
+        break;
+    }
+    case ENotification::REMOVE_MANY:
+    {
+        auto feature = getFeature( change );
+        auto list = getList( change );
+        const auto& values = anyCast<const std::vector<Any>&>( oldValue );
+        auto first = position == ENotification::NO_INDEX ? 0 : position;
+        for( std::size_t i = 0; i < values.size(); ++i )
+            ensureAdded( *list, values[i], first + i, !feature || feature->isUnique() );
+        break;
+    }
+    case ENotification::MOVE:
+    {
+        getList( change )->move( anyCast<std::size_t>( oldValue ), position );
+        break;
+    }
+    }
+}
+
+void EChangeRecorder::replay( const Change& change )
+{
+    const auto& oldValue = values_[change.oldValue_];
+    const auto& newValue = values_[change.newValue_];
+    std::size_t position = change.position_ == NO_POSITION ? ENotification::NO_INDEX : change.position_;
+    switch( change.eventType_ )
+    {
+    case ENotification::SET:
+    {
+        if( position != ENotification::NO_INDEX )
+            getList( change )->set( position, newValue );
+        else
+        {
+            auto eObject = std::static_pointer_cast<EObject>( notifiers_[change.notifier_] );
+            eObject->eSet( getFeature( change ), newValue );
+        }
+        break;
+    }
+    case ENotification::UNSET:
+    {
+        auto eObject = std::static_pointer_cast<EObject>( notifiers_[change.notifier_] );
+        eObject->eUnset( getFeature( change ) );
+        break;
+    }
+    case ENotification::ADD:
+    {
+        auto feature = getFeature( change );
+        ensureAdded( *getList( change ), newValue, position, !feature || feature->isUnique() );
+        break;
+    }
+    case ENotification::ADD_MANY:
+    {
+        auto feature = getFeature( change );
+        auto list = getList( change );
+        const auto& values = anyCast<const std::vector<Any>&>( newValue );
+        for( std::size_t i = 0; i < values.size(); ++i )
+            ensureAdded( *list, values[i], position + i, !feature || feature->isUnique() );
+        break;
+    }
+    case ENotification::REMOVE:
+    {
+        ensureRemoved( *getList( change ), oldValue, position );
+        break;
+    }
+    case ENotification::REMOVE_MANY:
+    {
+        auto list = getList( change );
+        for( const auto& value : anyCast<const std::vector<Any>&>( oldValue ) )
+            ensureRemoved( *list, value, ENotification::NO_INDEX );
+        break;
+    }
+    case ENotification::MOVE:
+    {
+        getList( change )->move( position, anyCast<std::size_t>( oldValue ) );
+        break;
+    }
+    }
+}
+
+std::shared_ptr<EList<Any>> EChangeRecorder::getList( const Change& change ) const
+{
+    const auto& notifier = notifiers_[change.notifier_];
+    if( auto eObject = std::dynamic_pointer_cast<EObject>( notifier ) )
+        return toList( eObject->eGet( getFeature( change ) ) );
+    if( auto eResource = std::dynamic_pointer_cast<EResource>( notifier ) )
+        return eResource->getContents()->asEListOf<Any>();
+    if( auto eResourceSet = std::dynamic_pointer_cast<EResourceSet>( notifier ) )
+        return eResourceSet->getResources()->asEListOf<Any>();
+    return nullptr;
+}
+
+std::shared_ptr<EStructuralFeature> EChangeRecorder::getFeature( const Change& change ) const
+{
+    auto eObject = std::dynamic_pointer_cast<EObject>( notifiers_[change.notifier_] );
+    return eObject ? eObject->eClass()->getEStructuralFeature( change.featureID_ ) : nullptr;
+}
+
+void EChangeRecorder::writeValue( std::ostream& os, const Change& change, const Any& value ) const
+{
+    if( value.empty() )
+        return;
+
+    if( auto values = _anyCast<std::vector<Any>>( &value ) )
+    {
+        os << '[';
+        for( const auto& v : *values )
+        {
+            if( &v != &values->front() )
+                os << ' ';
+            writeValue( os, change, v );
+        }
+        os << ']';
+    }
+    else if( auto eObject = _anyCast<std::shared_ptr<EObject>>( &value ) )
+    {
+        if( *eObject )
+            os << EcoreUtils::getURI( *eObject ).toString();
+    }
+    else if( auto eResource = _anyCast<std::shared_ptr<EResource>>( &value ) )
+    {
+        if( *eResource )
+            os << ( *eResource )->getURI().toString();
+    }
+    else if( auto p = _anyCast<std::size_t>( &value ) )
+        os << *p;
+    else if( auto feature = getFeature( change ) )
+    {
+        auto eDataType = std::static_pointer_cast<EDataType>( feature->getEType() );
+        auto eFactory = eDataType->getEPackage()->getEFactoryInstance();
+        writeString( os, eFactory->convertToString( eDataType, value ) );
+    }
+}
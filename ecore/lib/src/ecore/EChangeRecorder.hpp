@@ -0,0 +1,122 @@
+// *****************************************************************************
+//
+// This file is part of a MASA library or program.
+// Refer to the included end-user license agreement for restrictions.
+//
+// Copyright (c) 2020 MASA Group
+//
+// *****************************************************************************
+
+#ifndef ECORE_ECHANGERECORDER_HPP_
+#define ECORE_ECHANGERECORDER_HPP_
+
+#include "ecore/Any.hpp"
+#include "ecore/EContentAdapter.hpp"
+#include "ecore/Exports.hpp"
+
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace ecore
+{
+    template <typename T>
+    class EList;
+
+    class EObject;
+
+    /**
+     * A content adapter that records the changes of all the objects it is installed on,
+     * so that they can be rolled back, applied again or exported.
+     * It can be installed for an {@link EObject}, an {@link EResource} or an {@link EResourceSet}
+     */
+    class ECORE_API EChangeRecorder : public EContentAdapter
+    {
+    public:
+        EChangeRecorder() = default;
+
+        virtual ~EChangeRecorder() = default;
+
+        virtual void notifyChanged( const std::shared_ptr<ENotification>& notification );
+
+        virtual void setTarget( const std::shared_ptr<ENotifier>& target );
+
+        virtual void unsetTarget( const std::shared_ptr<ENotifier>& target );
+
+        /**
+         * Returns the number of recorded changes.
+         */
+        std::size_t getChangeCount() const;
+
+        /**
+         * Forgets the recorded changes.
+         */
+        void clear();
+
+        /**
+         * Reverts the recorded changes, most recent first.
+         * The changes are kept until a new change is recorded, so that they can be applied again.
+         */
+        void rollback();
+
+        /**
+         * Applies again the changes reverted by rollback.
+         */
+        void apply();
+
+        /**
+         * Writes the recorded changes, one per line, objects being written as their current uri.
+         */
+        void save( std::ostream& os ) const;
+
+    private:
+        // a change references its notifier and its values through their index in the tables below
+        struct Change
+        {
+            std::uint32_t notifier_;
+            std::int32_t featureID_;
+            std::uint32_t position_;
+            std::uint32_t oldValue_;
+            std::uint32_t newValue_;
+            std::uint8_t eventType_;
+            // the opposite side of a bidirectional change : it only restores the positions in its list
+            bool isOpposite_;
+            // false for a set of a single valued feature which was not set : it is reverted by an unset
+            bool wasSet_;
+        };
+
+        bool isRecorded( const std::shared_ptr<ENotification>& notification ) const;
+        void record( const std::shared_ptr<ENotification>& notification );
+        std::uint32_t addNotifier( const std::shared_ptr<ENotifier>& notifier );
+        std::uint32_t addValue( const Any& value );
+
+        bool isUnset( EObject* eObject, int featureID ) const;
+        void updateUnset( const std::shared_ptr<ENotification>& notification );
+
+        void revert( const Change& change );
+        void replay( const Change& change );
+
+        std::shared_ptr<EList<Any>> getList( const Change& change ) const;
+        std::shared_ptr<EStructuralFeature> getFeature( const Change& change ) const;
+
+        void writeValue( std::ostream& os, const Change& change, const Any& value ) const;
+
+    private:
+        std::vector<Change> changes_;
+        std::vector<std::shared_ptr<ENotifier>> notifiers_;
+        std::unordered_map<ENotifier*, std::uint32_t> notifierIndexes_;
+        // index 0 is the empty value, objects are stored once
+        std::vector<Any> values_{ Any() };
+        std::unordered_map<EObject*, std::uint32_t> objectIndexes_;
+        // ids of the unsettable single valued features which are not set, for each adapted object
+        std::unordered_map<EObject*, std::vector<int>> unsetFeatures_;
+        std::size_t oppositeCount_{ 0 };
+        bool isReplaying_{ false };
+        bool isRolledBack_{ false };
+    };
+
+} // namespace ecore
+
+#endif
@@ -1,9 +1,12 @@
 #include "ecore/EContentAdapter.hpp"
 #include "ecore/Any.hpp"
+#include "ecore/AnyCast.hpp"
 #include "ecore/EList.hpp"
 #include "ecore/ENotification.hpp"
 #include "ecore/EObject.hpp"
 #include "ecore/EReference.hpp"
+#include "ecore/EResource.hpp"
+#include "ecore/EResourceSet.hpp"
 #include "ecore/Stream.hpp"
 #include "ecore/impl/EObjectInternal.hpp"
 
@@ -12,6 +15,46 @@
 using namespace ecore;
 using namespace ecore::impl;
 
+namespace
+{
+    // calls f on each direct content of an object, a resource or a resource set
+    template <typename F>
+    void forEachContent( const std::shared_ptr<ENotifier>& notifier, F f )
+    {
+        if( !notifier )
+            return;
+
+        if( auto eObject = std::dynamic_pointer_cast<EObject>( notifier ) )
+        {
+            for( const auto& eContent : *eObject->eContents() )
+                f( eContent );
+        }
+        else if( auto eResource = std::dynamic_pointer_cast<EResource>( notifier ) )
+        {
+            // contents of a resource loaded on demand are adapted as they are added by its load
+            if( eResource->isLoadPending() )
+                return;
+
+            for( const auto& eContent : *eResource->getContents() )
+                f( eContent );
+        }
+        else if( auto eResourceSet = std::dynamic_pointer_cast<EResourceSet>( notifier ) )
+        {
+            for( const auto& eResource : *eResourceSet->getResources() )
+                f( eResource );
+        }
+    }
+
+    std::shared_ptr<ENotifier> toNotifier( const Any& value )
+    {
+        if( auto eObject = _anyCast<std::shared_ptr<EObject>>( &value ) )
+            return *eObject;
+        if( auto eResource = _anyCast<std::shared_ptr<EResource>>( &value ) )
+            return *eResource;
+        return nullptr;
+    }
+} // namespace
+
 void EContentAdapter::notifyChanged( const std::shared_ptr<ENotification>& notification )
 {
     selfAdapt( notification );
@@ -19,61 +62,62 @@ void EContentAdapter::notifyChanged( const std::shared_ptr<ENotification>& notif
 
 void EContentAdapter::setTarget( const std::shared_ptr<ENotifier>& newTarget )
 {
+    // a null target is the unset of the previous one : there are no contents to adapt
     AbstractAdapter::setTarget( newTarget );
-    if( newTarget )
-    {
-        auto eObject = std::static_pointer_cast<EObject>( newTarget );
-        auto eContents = eObject->eContents();
-        for( auto& eContent : eContents )
-            addAdapter( eContent );
-    }    
+    forEachContent( newTarget, [this]( const auto& eContent ) { addAdapter( eContent ); } );
 }
 
 void EContentAdapter::unsetTarget( const std::shared_ptr<ENotifier>& oldTarget )
 {
     AbstractAdapter::unsetTarget( oldTarget );
-    if( oldTarget )
-    {
-        auto eObject = std::static_pointer_cast<EObject>( oldTarget );
-        auto eContents = eObject->eContents();
-        for( auto& eContent : eContents )
-            removeAdapter( eContent );
-    }
+    forEachContent( oldTarget, [this]( const auto& eContent ) { removeAdapter( eContent ); } );
 }
 
-void EContentAdapter::addAdapter( const std::shared_ptr<EObject>& eObject )
+void EContentAdapter::addAdapter( const std::shared_ptr<ENotifier>& notifier )
 {
-    if( !eObject )
+    if( !notifier )
         return;
 
-    auto& eAdapters = eObject->eAdapters();
+    auto& eAdapters = notifier->eAdapters();
     if( !eAdapters.contains( this ) )
         eAdapters.add( this );
 }
 
-void EContentAdapter::removeAdapter( const std::shared_ptr<EObject>& eObject, bool checkContainer )
+void EContentAdapter::removeAdapter( const std::shared_ptr<ENotifier>& notifier, bool checkContainer )
 {
-    if( !eObject )
+    if( !notifier )
         return;
 
     if( checkContainer )
     {
-        auto container = eObject->getInternal().eInternalContainer();
+        auto eObject = std::dynamic_pointer_cast<EObject>( notifier );
+        auto container = eObject ? eObject->getInternal().eInternalContainer() : nullptr;
         if( container && container->eAdapters().contains( this ) )
             return;
     }
-    eObject->eAdapters().remove( this );
+    notifier->eAdapters().remove( this );
 }
 
 void EContentAdapter::selfAdapt( const std::shared_ptr<ENotification>& notification )
 {
-    auto feature = notification->getFeature();
-    auto reference = std::dynamic_pointer_cast<EReference>( feature );
-    if( reference && reference->isContainment() )
-        handleContainment( notification );
+    if( auto feature = notification->getFeature() )
+    {
+        auto reference = std::dynamic_pointer_cast<EReference>( feature );
+        if( reference && reference->isContainment() )
+            handleContainment( notification );
+    }
+    else
+    {
+        // resources and resource sets have no meta model : their contents are identified by feature id
+        auto notifier = notification->getNotifier();
+        auto featureID = notification->getFeatureID();
+        if( ( featureID == EResource::RESOURCE__CONTENTS && std::dynamic_pointer_cast<EResource>( notifier ) )
+            || ( featureID == EResourceSet::RESOURCE_SET__RESOURCES && std::dynamic_pointer_cast<EResourceSet>( notifier ) ) )
+            handleContainment( notification );
+    }
 }
 
-void ecore::EContentAdapter::handleContainment( const std::shared_ptr<ENotification>& notification )
+void EContentAdapter::handleContainment( const std::shared_ptr<ENotification>& notification )
 {
     switch( notification->getEventType() )
     {
@@ -98,43 +142,43 @@ void ecore::EContentAdapter::handleContainment( const std::shared_ptr<ENotificat
         auto oldValue = notification->getOldValue();
         if( oldValue.type() != typeid( bool ) )
         {
-            removeAdapter( anyCast<std::shared_ptr<EObject>>( notification->getOldValue() ) );
-            addAdapter( anyCast<std::shared_ptr<EObject>>( notification->getNewValue() ) );
+            removeAdapter( toNotifier( oldValue ) );
+            addAdapter( toNotifier( notification->getNewValue() ) );
         }
         break;
     }
     case ENotification::SET:
     {
-        removeAdapter( anyCast<std::shared_ptr<EObject>>( notification->getOldValue() ) );
-        addAdapter( anyCast<std::shared_ptr<EObject>>( notification->getNewValue() ) );
+        removeAdapter( toNotifier( notification->getOldValue() ) );
+        addAdapter( toNotifier( notification->getNewValue() ) );
         break;
     }
     case ENotification::ADD:
     {
-        addAdapter( anyCast<std::shared_ptr<EObject>>( notification->getNewValue() ) );
+        addAdapter( toNotifier( notification->getNewValue() ) );
         break;
     }
     case ENotification::ADD_MANY:
     {
-        std::vector<Any> newValues = anyCast<std::vector<Any>>( notification->getNewValue() );
+        std::vector<Any> newValues = anyValuesCast( notification->getNewValue() );
         for( auto& newValue : newValues )
         {
-            auto notifier = anyCast<std::shared_ptr<EObject>>( newValue );
+            auto notifier = toNotifier( newValue );
             addAdapter( notifier );
         }
         break;
     }
     case ENotification::REMOVE:
     {
-        removeAdapter( anyCast<std::shared_ptr<EObject>>( notification->getOldValue() ) );
+        removeAdapter( toNotifier( notification->getOldValue() ) );
         break;
     }
     case ENotification::REMOVE_MANY:
     {
-        std::vector<Any> oldValues = anyCast<std::vector<Any>>( notification->getOldValue() );
+        std::vector<Any> oldValues = anyValuesCast( notification->getOldValue() );
         for( auto& oldValue : oldValues )
         {
-            auto notifier = anyCast<std::shared_ptr<EObject>>( oldValue );
+            auto notifier = toNotifier( oldValue );
             removeAdapter( notifier );
         }
         break;
@@ -22,7 +22,7 @@ namespace ecore
     /**
      * An adapter that maintains itself as an adapter for all contained objects
      * as they come and go.
-     * It can be installed for an {@link EObject}
+     * It can be installed for an {@link EObject}, an {@link EResource} or an {@link EResourceSet}
      */
     class ECORE_API EContentAdapter : public impl::AbstractAdapter
     {
@@ -42,9 +42,9 @@ namespace ecore
 
         void handleContainment( const std::shared_ptr<ENotification>& notification );
 
-        void addAdapter( const std::shared_ptr<EObject>& eObject );
+        void addAdapter( const std::shared_ptr<ENotifier>& notifier );
 
-        void removeAdapter( const std::shared_ptr<EObject>& eObject , bool checkContainer = false );
+        void removeAdapter( const std::shared_ptr<ENotifier>& notifier, bool checkContainer = false );
     };
 
 } // namespace ecore
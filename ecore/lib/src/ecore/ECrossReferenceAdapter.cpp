@@ -0,0 +1,236 @@
+#include "ecore/ECrossReferenceAdapter.hpp"
+#include "ecore/Any.hpp"
+#include "ecore/AnyCast.hpp"
+#include "ecore/ECollectionView.hpp"
+#include "ecore/EClass.hpp"
+#include "ecore/EList.hpp"
+#include "ecore/ENotification.hpp"
+#include "ecore/EObject.hpp"
+#include "ecore/EReference.hpp"
+#include "ecore/EResource.hpp"
+#include "ecore/EResourceSet.hpp"
+
+#include <algorithm>
+
+using namespace ecore;
+using namespace ecore::impl;
+
+namespace
+{
+    // cross references are the references that are neither containments nor containers
+    bool isCrossReference( const std::shared_ptr<EReference>& eReference )
+    {
+        return eReference && !eReference->isContainment() && !eReference->isContainer() && !eReference->isDerived();
+    }
+
+    // calls f on each object referenced by eObject through eReference, proxies are not resolved
+    template <typename F>
+    void forEachReferenced( const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EReference>& eReference, F f )
+    {
+        if( !eObject->eIsSet( eReference ) )
+            return;
+
+        auto value = eObject->eGet( eReference, false );
+        if( eReference->isMany() )
+        {
+            auto l = anyListCast<std::shared_ptr<EObject>>( value );
+            for( const auto& eReferenced : *l->getUnResolvedList() )
+                f( eReferenced );
+        }
+        else if( auto eReferenced = anyObjectCast<std::shared_ptr<EObject>>( value ) )
+            f( eReferenced );
+    }
+
+    std::shared_ptr<EObject> toObject( const Any& value )
+    {
+        return value.empty() ? nullptr : anyObjectCast<std::shared_ptr<EObject>>( value );
+    }
+} // namespace
+
+void ECrossReferenceAdapter::notifyChanged( const std::shared_ptr<ENotification>& notification )
+{
+    EContentAdapter::notifyChanged( notification );
+    handleCrossReference( notification );
+}
+
+void ECrossReferenceAdapter::setTarget( const std::shared_ptr<ENotifier>& newTarget )
+{
+    // a notifier without this pointer can't be indexed
+    if( auto eObject = std::dynamic_pointer_cast<EObject>( newTarget ) )
+        addCrossReferences( eObject );
+    EContentAdapter::setTarget( newTarget );
+}
+
+void ECrossReferenceAdapter::unsetTarget( const std::shared_ptr<ENotifier>& oldTarget )
+{
+    if( auto eObject = std::dynamic_pointer_cast<EObject>( oldTarget ) )
+        removeCrossReferences( eObject );
+    EContentAdapter::unsetTarget( oldTarget );
+}
+
+std::vector<ECrossReferenceAdapter::Setting> ECrossReferenceAdapter::getInverseReferences( const std::shared_ptr<EObject>& eObject ) const
+{
+    std::vector<Setting> settings;
+    auto it = inverseReferences_.find( eObject.get() );
+    if( it == inverseReferences_.end() || it->second.eTarget_.lock() != eObject )
+        return settings;
+
+    auto& references = it->second.references_;
+    settings.reserve( references.size() );
+    for( const auto& reference : references )
+    {
+        if( auto eSource = reference.eSource_.lock() )
+            settings.emplace_back( eSource, reference.eReference_ );
+    }
+    return settings;
+}
+
+std::vector<ECrossReferenceAdapter::Setting> ECrossReferenceAdapter::getUsages( const std::shared_ptr<EObject>& eObject,
+                                                                                const std::shared_ptr<EResourceSet>& resourceSet )
+{
+    if( !eObject || !resourceSet )
+        return {};
+
+    for( auto eAdapter : resourceSet->eAdapters() )
+    {
+        if( auto crossReferenceAdapter = dynamic_cast<ECrossReferenceAdapter*>( eAdapter ) )
+            return crossReferenceAdapter->getInverseReferences( eObject );
+    }
+
+    // no index : scan the cross references of all the objects of the resource set
+    std::vector<Setting> settings;
+    for( const auto& eResource : *resourceSet->getResources() )
+    {
+        for( const auto& eSource : *eResource->getAllContents() )
+        {
+            for( const auto& eReference : *eSource->eClass()->getEAllReferences() )
+            {
+                if( !isCrossReference( eReference ) )
+                    continue;
+
+                forEachReferenced( eSource, eReference, [&]( const std::shared_ptr<EObject>& eReferenced ) {
+                    if( eReferenced == eObject )
+                        settings.emplace_back( eSource, eReference );
+                } );
+            }
+        }
+    }
+    return settings;
+}
+
+void ECrossReferenceAdapter::handleCrossReference( const std::shared_ptr<ENotification>& notification )
+{
+    auto eReference = std::dynamic_pointer_cast<EReference>( notification->getFeature() );
+    if( !isCrossReference( eReference ) )
+        return;
+
+    auto eSource = std::dynamic_pointer_cast<EObject>( notification->getNotifier() );
+    if( !eSource )
+        return;
+
+    switch( notification->getEventType() )
+    {
+    case ENotification::RESOLVE:
+    case ENotification::SET:
+    case ENotification::UNSET:
+    {
+        // unsettable lists notify their unset with booleans : they are not references
+        auto oldValue = notification->getOldValue();
+        if( oldValue.type() == typeid( bool ) )
+            break;
+
+        removeInverseReference( eSource, eReference, toObject( oldValue ) );
+        addInverseReference( eSource, eReference, toObject( notification->getNewValue() ) );
+        break;
+    }
+    case ENotification::ADD:
+    {
+        addInverseReference( eSource, eReference, toObject( notification->getNewValue() ) );
+        break;
+    }
+    case ENotification::ADD_MANY:
+    {
+        std::vector<Any> newValues = anyValuesCast( notification->getNewValue() );
+        for( const auto& newValue : newValues )
+            addInverseReference( eSource, eReference, toObject( newValue ) );
+        break;
+    }
+    case ENotification::REMOVE:
+    {
+        removeInverseReference( eSource, eReference, toObject( notification->getOldValue() ) );
+        break;
+    }
+    case ENotification::REMOVE_MANY:
+    {
+        std::vector<Any> oldValues = anyValuesCast( notification->getOldValue() );
+        for( const auto& oldValue : oldValues )
+            removeInverseReference( eSource, eReference, toObject( oldValue ) );
+        break;
+    }
+    }
+}
+
+void ECrossReferenceAdapter::addCrossReferences( const std::shared_ptr<EObject>& eObject )
+{
+    for( const auto& eReference : *eObject->eClass()->getEAllReferences() )
+    {
+        if( isCrossReference( eReference ) )
+            forEachReferenced( eObject, eReference, [&]( const std::shared_ptr<EObject>& eReferenced ) {
+                addInverseReference( eObject, eReference, eReferenced );
+            } );
+    }
+}
+
+void ECrossReferenceAdapter::removeCrossReferences( const std::shared_ptr<EObject>& eObject )
+{
+    for( const auto& eReference : *eObject->eClass()->getEAllReferences() )
+    {
+        if( isCrossReference( eReference ) )
+            forEachReferenced( eObject, eReference, [&]( const std::shared_ptr<EObject>& eReferenced ) {
+                removeInverseReference( eObject, eReference, eReferenced );
+            } );
+    }
+}
+
+void ECrossReferenceAdapter::addInverseReference( const std::shared_ptr<EObject>& eSource,
+                                                  const std::shared_ptr<EReference>& eReference,
+                                                  const std::shared_ptr<EObject>& eTarget )
+{
+    if( !eTarget )
+        return;
+
+    auto& inverseReferences = inverseReferences_[eTarget.get()];
+    if( inverseReferences.eTarget_.lock() != eTarget )
+    {
+        // new target or a destroyed one whose address is reused
+        inverseReferences.eTarget_ = eTarget;
+        inverseReferences.references_.clear();
+    }
+    inverseReferences.references_.push_back( InverseReference{ eSource.get(), eSource, eReference } );
+}
+
+void ECrossReferenceAdapter::removeInverseReference( const std::shared_ptr<EObject>& eSource,
+                                                     const std::shared_ptr<EReference>& eReference,
+                                                     const std::shared_ptr<EObject>& eTarget )
+{
+    if( !eTarget )
+        return;
+
+    auto it = inverseReferences_.find( eTarget.get() );
+    if( it == inverseReferences_.end() )
+        return;
+
+    auto& references = it->second.references_;
+    auto itReference = std::find_if( references.begin(), references.end(), [&]( const InverseReference& reference ) {
+        return reference.source_ == eSource.get() && reference.eReference_ == eReference;
+    } );
+    if( itReference != references.end() )
+    {
+        // order of the inverse references is not significant
+        if( itReference != std::prev( references.end() ) )
+            *itReference = std::move( references.back() );
+        references.pop_back();
+    }
+    if( references.empty() )
+        inverseReferences_.erase( it );
+}
@@ -0,0 +1,99 @@
+// *****************************************************************************
+//
+// This file is part of a MASA library or program.
+// Refer to the included end-user license agreement for restrictions.
+//
+// Copyright (c) 2020 MASA Group
+//
+// *****************************************************************************
+
+#ifndef ECORE_ECROSSREFERENCEADAPTER_HPP_
+#define ECORE_ECROSSREFERENCEADAPTER_HPP_
+
+#include "ecore/EContentAdapter.hpp"
+#include "ecore/Exports.hpp"
+
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ecore
+{
+    class EObject;
+    class EReference;
+    class EResourceSet;
+
+    /**
+     * A content adapter that maintains an index of the cross references
+     * of all the objects it is installed on : it answers which objects reference a given object
+     * without scanning the whole model.
+     * It can be installed for an {@link EObject}, an {@link EResource} or an {@link EResourceSet}
+     */
+    class ECORE_API ECrossReferenceAdapter : public EContentAdapter
+    {
+    public:
+        /**
+         * A source object and the reference through which it references the target.
+         */
+        typedef std::pair<std::shared_ptr<EObject>, std::shared_ptr<EReference>> Setting;
+
+        ECrossReferenceAdapter() = default;
+
+        virtual ~ECrossReferenceAdapter() = default;
+
+        virtual void notifyChanged( const std::shared_ptr<ENotification>& notification );
+
+        virtual void setTarget( const std::shared_ptr<ENotifier>& target );
+
+        virtual void unsetTarget( const std::shared_ptr<ENotifier>& target );
+
+        /**
+         * Returns the settings of the adapted objects referencing eObject.
+         */
+        std::vector<Setting> getInverseReferences( const std::shared_ptr<EObject>& eObject ) const;
+
+        /**
+         * Returns the settings of the objects of resourceSet referencing eObject.
+         * The index of the ECrossReferenceAdapter installed on resourceSet is used if any,
+         * otherwise the resources are scanned.
+         */
+        static std::vector<Setting> getUsages( const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EResourceSet>& resourceSet );
+
+    private:
+        void handleCrossReference( const std::shared_ptr<ENotification>& notification );
+
+        void addCrossReferences( const std::shared_ptr<EObject>& eObject );
+
+        void removeCrossReferences( const std::shared_ptr<EObject>& eObject );
+
+        void addInverseReference( const std::shared_ptr<EObject>& eSource,
+                                  const std::shared_ptr<EReference>& eReference,
+                                  const std::shared_ptr<EObject>& eTarget );
+
+        void removeInverseReference( const std::shared_ptr<EObject>& eSource,
+                                     const std::shared_ptr<EReference>& eReference,
+                                     const std::shared_ptr<EObject>& eTarget );
+
+    private:
+        struct InverseReference
+        {
+            EObject* source_;
+            std::weak_ptr<EObject> eSource_;
+            std::shared_ptr<EReference> eReference_;
+        };
+
+        struct InverseReferences
+        {
+            std::weak_ptr<EObject> eTarget_;
+            std::vector<InverseReference> references_;
+        };
+
+        // indexed by target : objects are only weakly referenced,
+        // the index must not keep alive an object removed from the model
+        std::unordered_map<EObject*, InverseReferences> inverseReferences_;
+    };
+
+} // namespace ecore
+
+#endif
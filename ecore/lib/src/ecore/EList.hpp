@@ -201,6 +201,15 @@ namespace ecore
                 return delegate_->addAll( pos, *transformed );
             }
 
+            virtual bool addAllUnique( std::size_t pos, const Collection<T>& l )
+            {
+                auto transformed = l.asCollectionOf<Q>();
+                if constexpr( IsSharedEObjectOrAny<Q>::value )
+                    return delegate_->addAllUnique( pos, *transformed );
+                else
+                    return delegate_->addAll( pos, *transformed );
+            }
+
             virtual void move( std::size_t newPos, const T& e )
             {
                 delegate_->move( newPos, cast<T, Q>::do_cast( e ) );
@@ -23,6 +23,12 @@ namespace ecore
     public:
         virtual ~EObjectList() = default;
 
+        // Adds objects that are known not to be in the list : lists checking their uniqueness don't check it again
+        virtual bool addAllUnique( std::size_t pos, const Collection<T>& l )
+        {
+            return this->addAll( pos, l );
+        }
+
         virtual std::shared_ptr<L> getUnResolvedList() = 0;
 
         virtual std::shared_ptr<const L> getUnResolvedList() const = 0;
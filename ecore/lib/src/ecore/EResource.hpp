@@ -10,9 +10,11 @@
 #ifndef ECORE_ERESOURCE_HPP_
 #define ECORE_ERESOURCE_HPP_
 
+#include "ecore/Any.hpp"
 #include "ecore/Exports.hpp"
 #include "ecore/ENotifier.hpp"
 
+#include <map>
 #include <memory>
 #include <string>
 
@@ -28,6 +30,8 @@ namespace ecore
     class EDiagnostic;
     class EObject;
     class EResourceIDManager;
+    class EResourceStatistics;
+    class EResourceTypeIndex;
     class EResourceSet;
     
     class URI;
@@ -55,6 +59,12 @@ namespace ecore
          */
         static const int RESOURCE__IS_LOADED = 4;
 
+        /**
+         * The options of a load or a save, keyed by the OPTION_ names of the resource implementations.
+         * An option which is not set takes its default value.
+         */
+        typedef std::map<std::string, Any> Options;
+
     public:
         virtual ~EResource() = default;
 
@@ -80,14 +90,42 @@ namespace ecore
 
         virtual void load( std::istream& is ) = 0;
 
+        virtual void load( const Options& options ) = 0;
+
+        virtual void load( std::istream& is, const Options& options ) = 0;
+
         virtual void unload() = 0;
 
         virtual bool isLoaded() const = 0;
 
+        virtual bool isLoadOnDemand() const = 0;
+
+        virtual void setLoadOnDemand( bool isLoadOnDemand ) = 0;
+
+        virtual bool isLoadPending() const = 0;
+
         virtual void save() = 0;
 
         virtual void save( std::ostream& os )= 0;
 
+        virtual void save( const Options& options ) = 0;
+
+        virtual void save( std::ostream& os, const Options& options ) = 0;
+
+        virtual void loadDelta( std::istream& is ) = 0;
+
+        virtual void loadDelta( std::istream& is, const Options& options ) = 0;
+
+        virtual void saveDelta( std::ostream& os ) = 0;
+
+        virtual void saveDelta( std::ostream& os, const Options& options ) = 0;
+
+        virtual bool isTrackingModification() const = 0;
+
+        virtual void setTrackingModification( bool isTrackingModification ) = 0;
+
+        virtual bool isModified() const = 0;
+
         virtual std::shared_ptr<EList<std::shared_ptr<EDiagnostic>>> getErrors() const = 0;
 
         virtual std::shared_ptr<EList<std::shared_ptr<EDiagnostic>>> getWarnings() const = 0;
@@ -96,6 +134,14 @@ namespace ecore
 
         virtual void setIDManager( const std::shared_ptr<EResourceIDManager>& resourceIDManager ) = 0;
 
+        virtual std::shared_ptr<EResourceTypeIndex> getTypeIndex() const = 0;
+
+        virtual void setTypeIndex( const std::shared_ptr<EResourceTypeIndex>& resourceTypeIndex ) = 0;
+
+        virtual std::shared_ptr<EResourceStatistics> getStatistics() const = 0;
+
+        virtual void setStatistics( const std::shared_ptr<EResourceStatistics>& resourceStatistics ) = 0;
+
     };
 
 } // namespace ecore
@@ -0,0 +1,61 @@
+// *****************************************************************************
+//
+// This file is part of a MASA library or program.
+// Refer to the included end-user license agreement for restrictions.
+//
+// Copyright (c) 2020 MASA Group
+//
+// *****************************************************************************
+
+#ifndef ECORE_ERESOURCESTATISTICS_HPP_
+#define ECORE_ERESOURCESTATISTICS_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+
+namespace ecore
+{
+    class EClass;
+
+    // Receives the events of the loads and saves of a resource.
+    // Nothing is measured for a resource without statistics.
+    class EResourceStatistics
+    {
+    public:
+        enum class Phase
+        {
+            PARSE,
+            NAMESPACES,
+            HANDLE_REFERENCES,
+            SERIALIZE,
+            WRITE
+        };
+
+        virtual ~EResourceStatistics() = default;
+
+        virtual void elementParsed() = 0;
+
+        virtual void objectCreated( const std::shared_ptr<EClass>& eClass ) = 0;
+
+        // a value converted from or to its string representation
+        virtual void attributeConverted() = 0;
+
+        virtual void referenceDeferred() = 0;
+
+        virtual void referenceResolved() = 0;
+
+        virtual void proxyCreated() = 0;
+
+        virtual void bytesRead( std::size_t count ) = 0;
+
+        virtual void bytesWritten( std::size_t count ) = 0;
+
+        // a phase may end several times during a load or a save, its durations are to be summed.
+        // Phases are exclusive : the durations of PARSE don't include NAMESPACES and HANDLE_REFERENCES run while parsing
+        virtual void phaseEnded( Phase phase, std::chrono::nanoseconds duration ) = 0;
+    };
+
+}
+
+#endif
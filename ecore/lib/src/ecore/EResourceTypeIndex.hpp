@@ -0,0 +1,38 @@
+// *****************************************************************************
+//
+// This file is part of a MASA library or program.
+// Refer to the included end-user license agreement for restrictions.
+//
+// Copyright (c) 2020 MASA Group
+//
+// *****************************************************************************
+
+#ifndef ECORE_ERESOURCETYPEINDEX_HPP_
+#define ECORE_ERESOURCETYPEINDEX_HPP_
+
+#include <memory>
+#include <vector>
+
+namespace ecore
+{
+    class EClass;
+    class EObject;
+
+    class EResourceTypeIndex
+    {
+    public:
+        virtual ~EResourceTypeIndex() = default;
+
+        virtual void clear() = 0;
+
+        virtual void registerObject( const std::shared_ptr<EObject>& eObject ) = 0;
+
+        virtual void unregisterObject( const std::shared_ptr<EObject>& eObject ) = 0;
+
+        // Returns the registered instances of eClass and of its sub classes, in no particular order.
+        virtual std::vector<std::shared_ptr<EObject>> getInstances( const std::shared_ptr<EClass>& eClass ) const = 0;
+    };
+
+}
+
+#endif
@@ -12,6 +12,7 @@
 #include "ecore/impl/DeepCopy.hpp"
 #include "ecore/impl/DeepEqual.hpp"
 #include "ecore/impl/EObjectInternal.hpp"
+#include "ecore/impl/PrimitiveConverter.hpp"
 #include "ecore/impl/StringUtils.hpp"
 
 #include <deque>
@@ -45,12 +46,20 @@ void EcoreUtils::setID( const std::shared_ptr<EObject>& eObject, const std::stri
 
 std::string EcoreUtils::convertToString( const std::shared_ptr<EDataType>& eDataType, const Any& value )
 {
+    std::string literal;
+    if( PrimitiveConverter::convertToString( PrimitiveConverter::getKind( eDataType ), value, literal ) )
+        return literal;
+
     auto eFactory = eDataType->getEPackage()->getEFactoryInstance();
     return eFactory->convertToString( eDataType, value );
 }
 
 Any EcoreUtils::createFromString( const std::shared_ptr<EDataType>& eDataType, const std::string& literal )
 {
+    Any value;
+    if( PrimitiveConverter::createFromString( PrimitiveConverter::getKind( eDataType ), literal, value ) )
+        return value;
+
     auto eFactory = eDataType->getEPackage()->getEFactoryInstance();
     return eFactory->createFromString( eDataType, literal );
 }
@@ -109,10 +118,16 @@ std::string EcoreUtils::getRelativeURIFragmentPath( const std::shared_ptr<EObjec
 
 std::shared_ptr<EObject> EcoreUtils::getEObject( const std::shared_ptr<EObject>& rootEObject, const std::string& relativeFragmentPath )
 {
-    auto segments = split( relativeFragmentPath, "/" );
+    std::string_view path = relativeFragmentPath;
     auto eObject = rootEObject;
-    for( int i = 0; i < segments.size() && eObject; ++i )
-        eObject = eObject->getInternal().eObjectForFragmentSegment( std::string( segments[i] ) );
+    for( std::size_t start = 0; eObject; )
+    {
+        auto end = path.find( '/', start );
+        eObject = eObject->getInternal().eObjectForFragmentSegment( path.substr( start, end - start ) );
+        if( end == std::string_view::npos )
+            break;
+        start = end + 1;
+    }
     return eObject;
 }
 
@@ -180,16 +195,8 @@ bool EcoreUtils::isAssignableFrom( const std::shared_ptr<EClass>& eSuper, const
 {
     if( eClass == eSuper )
         return true;
-    else if( eClass )
-    {
-        auto supers = eClass->getESuperTypes();
-        for( auto s : supers )
-        {
-            if( isAssignableFrom( eSuper, s ) )
-                return true;
-        }
-    }
-    return false;
+    // a bit test in the class ids of the super types of eClass
+    return eClass && eSuper && eSuper->isSuperTypeOf( eClass );
 }
 
 std::shared_ptr<EObject> ecore::EcoreUtils::copy( const std::shared_ptr<EObject>& eObject )
@@ -219,3 +226,8 @@ bool EcoreUtils::equals( const std::shared_ptr<EList<std::shared_ptr<EObject>>>&
 {
     return DeepEqual().equals( l1, l2 );
 }
+
+bool EcoreUtils::equals( const std::shared_ptr<EResource>& r1, const std::shared_ptr<EResource>& r2, bool parallel )
+{
+    return DeepEqual().equals( r1, r2, parallel );
+}
@@ -63,6 +63,9 @@ namespace ecore
         static bool equals( const std::shared_ptr<EList<std::shared_ptr<EObject>>>& l1,
                             const std::shared_ptr<EList<std::shared_ptr<EObject>>>& l2 );
 
+        // Compares the contents of two resources, their roots are hashed in parallel first if parallel is true.
+        static bool equals( const std::shared_ptr<EResource>& r1, const std::shared_ptr<EResource>& r2, bool parallel = false );
+
     private:
         static std::string getRelativeURIFragmentPath( const std::shared_ptr<EObject>& ancestor,
                                                        const std::shared_ptr<EObject>& descendant,
@@ -2,12 +2,10 @@
 #include "ecore/Assert.hpp"
 #include "ecore/impl/StringUtils.hpp"
 
-#include <boost/regex.hpp>
-
 #include <algorithm>
 #include <array>
 #include <cctype>
-#include <sstream>
+#include <stdexcept>
 #include <utility>
 
 using namespace ecore;
@@ -16,10 +14,24 @@ using namespace ecore::detail;
 
 namespace
 {
-    std::string submatch( const boost::smatch& m, int idx )
+    inline bool isAlpha( char c )
+    {
+        return ( c >= 'a' && c <= 'z' ) || ( c >= 'A' && c <= 'Z' );
+    }
+
+    inline bool isDigit( char c )
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    inline bool isSchemeChar( char c )
+    {
+        return isAlpha( c ) || isDigit( c ) || c == '+' || c == '.' || c == '-';
+    }
+
+    inline char toLower( char c )
     {
-        const auto& sub = m[idx];
-        return std::string( sub.first, sub.second );
+        return c >= 'A' && c <= 'Z' ? static_cast<char>( c - 'A' + 'a' ) : c;
     }
 
     template <typename MakeItem, std::size_t... Index>
@@ -433,71 +445,119 @@ URI::URI()
 
 URI::URI( const std::string& str )
 {
-    static const boost::regex uriRegex( "(([a-zA-Z][a-zA-Z0-9+.-]*):)?" // scheme:
-                                      "([^?#]*)"                      // authority and path
-                                      "(?:\\?([^#]*))?"               // ?query
-                                      "(?:#(.*))?" );                 // #fragment
-    static const boost::regex authorityAndPathRegex( "//([^/]*)(/.*)?" );
-
-    boost::smatch  match;
-    if( !boost::regex_match( str.begin(), str.end(), match, uriRegex ) )
-        throw std::invalid_argument( "invalid URI :'" + str + "'" );
-
-    scheme_ = submatch( match, 2 );
-    std::transform( scheme_.begin(), scheme_.end(), scheme_.begin(), ::tolower );
-
-    const std::string authorityAndPath( match[3].first, match[3].second );
-    boost::smatch authorityAndPathMatch;
-    if( !boost::regex_match(
-            authorityAndPath.begin(), authorityAndPath.end(), authorityAndPathMatch, authorityAndPathRegex ) )
+    // single pass RFC 3986 split :
+    // [scheme:][//[username[:password]@]host[:port]][path][?query][#fragment]
+    const char* const begin = str.data();
+    const char* const end = begin + str.size();
+    const char* p = begin;
+
+    // scheme
+    if( p != end && isAlpha( *p ) )
+    {
+        const char* q = p + 1;
+        while( q != end && isSchemeChar( *q ) )
+            ++q;
+        if( q != end && *q == ':' )
+        {
+            scheme_.resize( q - p );
+            std::transform( p, q, scheme_.begin(), toLower );
+            p = q + 1;
+        }
+    }
+
+    // authority and path ends at query or fragment
+    const char* pathEnd = p;
+    while( pathEnd != end && *pathEnd != '?' && *pathEnd != '#' )
+        ++pathEnd;
+
+    if( pathEnd - p >= 2 && p[0] == '/' && p[1] == '/' )
+    {
+        const char* authority = p + 2;
+        const char* authorityEnd = std::find( authority, pathEnd, '/' );
+        parseAuthority( authority, authorityEnd );
+        path_.assign( authorityEnd, pathEnd );
+    }
+    else
+        path_.assign( p, pathEnd );
+
+    p = pathEnd;
+
+    // query
+    if( p != end && *p == '?' )
+    {
+        const char* queryEnd = std::find( p + 1, end, '#' );
+        query_.assign( p + 1, queryEnd );
+        p = queryEnd;
+    }
+
+    // fragment
+    if( p != end && *p == '#' )
+        fragment_.assign( p + 1, end );
+}
+
+void URI::parseAuthority( const char* begin, const char* end )
+{
+    const char* p = begin;
+
+    // [username[:password]@]
+    const char* at = std::find( p, end, '@' );
+    if( at != end )
     {
-        // Does not start with //, doesn't have authority
-        path_ = authorityAndPath;
+        const char* colon = std::find( p, at, ':' );
+        username_.assign( p, colon );
+        if( colon != at )
+            password_.assign( colon + 1, at );
+        p = at + 1;
+    }
+
+    // host : IP-literal (e.g. '['+IPv6+']'), dotted-IPv4, or named host
+    const char* hostEnd = p;
+    if( p != end && *p == '[' )
+    {
+        hostEnd = std::find( p, end, ']' );
+        if( hostEnd == end )
+            throw std::invalid_argument( "invalid URI authority " + std::string( begin, end ) );
+        ++hostEnd;
     }
     else
     {
-        static const boost::regex authorityRegex(
-            "(?:([^@:]*)(?::([^@]*))?@)?" // username, password
-            "(\\[[^\\]]*\\]|[^\\[:]*)"    // host (IP-literal (e.g. '['+IPv6+']',dotted-IPv4, or named host)
-            "(?::(\\d*))?" );             // port
-
-        const auto authority = authorityAndPathMatch[1];
-        boost::smatch authorityMatch;
-        if( !boost::regex_match( authority.first, authority.second, authorityMatch, authorityRegex ) )
-            throw std::invalid_argument( "invalid URI authority " + std::string( authority.first, authority.second ) );
-
-        std::string port( authorityMatch[4].first, authorityMatch[4].second );
-        if( !port.empty() )
-            port_ = stoi( port );
-
-        username_ = submatch( authorityMatch, 1 );
-        password_ = submatch( authorityMatch, 2 );
-        host_ = submatch( authorityMatch, 3 );
-        path_ = submatch( authorityAndPathMatch, 2 );
+        while( hostEnd != end && *hostEnd != ':' && *hostEnd != '[' )
+            ++hostEnd;
     }
+    host_.assign( p, hostEnd );
+    p = hostEnd;
 
-    query_ = submatch( match, 4 );
-    fragment_ = submatch( match, 5 );
+    // [:port]
+    if( p != end && *p == ':' )
+    {
+        unsigned int port = 0;
+        for( ++p; p != end && isDigit( *p ); ++p )
+            port = port * 10 + ( *p - '0' );
+        port_ = static_cast<uint16_t>( port );
+    }
+
+    if( p != end )
+        throw std::invalid_argument( "invalid URI authority " + std::string( begin, end ) );
 }
 
 std::string URI::getAuthority() const
 {
-    std::stringstream s;
+    std::string s;
     if( !username_.empty() || !password_.empty() )
     {
-        s << username_;
+        s.append( username_ );
 
         if( !password_.empty() )
-            s << ':' << password_;
+            s.append( 1, ':' ).append( password_ );
 
-        s << '@';
+        s.append( 1, '@' );
     }
 
-    s << host_;
+    s.append( host_ );
     if( port_ != 0 )
-        s << ':' << port_;
+        s.append( 1, ':' ).append( std::to_string( port_ ) );
 
-    return s.str();
+    return s;
 }
 
 std::string URI::getHostName() const
@@ -514,24 +574,23 @@ const std::vector<std::pair<std::string, std::string>>& URI::getQueryParams()
 {
     if( !query_.empty() && queryParams_.empty() )
     {
-        // Parse query string
-        static const boost::regex queryParamRegex(
-            "(^|&)"      /*start of query or start of parameter "&"*/
-            "([^=&]*)=?" /*parameter name and "=" if value is expected*/
-            "([^=&]*)"   /*parameter value*/
-            "(?=(&|$))"  /*forward reference, next should be end of query or start of next parameter*/ );
-        const boost::cregex_iterator paramBeginItr( query_.data(), query_.data() + query_.size(), queryParamRegex );
-        boost::cregex_iterator paramEndItr;
-        for( auto itr = paramBeginItr; itr != paramEndItr; ++itr )
+        // Parse query string : parameters are separated by '&',
+        // parameters with an empty name or with more than one '=' are ignored
+        const char* const begin = query_.data();
+        const char* const end = begin + query_.size();
+        for( const char* p = begin;; )
         {
-            if( itr->length( 2 ) == 0 )
+            const char* paramEnd = std::find( p, end, '&' );
+            const char* equal = std::find( p, paramEnd, '=' );
+            if( equal != p && ( equal == paramEnd || std::find( equal + 1, paramEnd, '=' ) == paramEnd ) )
             {
-                // key is empty, ignore it
-                continue;
+                queryParams_.emplace_back( std::string( p, equal ),                                              // parameter name
+                                           equal == paramEnd ? std::string() : std::string( equal + 1, paramEnd ) // parameter value
+                );
             }
-            queryParams_.emplace_back( std::string( ( *itr )[2].first, ( *itr )[2].second ), // parameter name
-                                       std::string( ( *itr )[3].first, ( *itr )[3].second )  // parameter value
-            );
+            if( paramEnd == end )
+                break;
+            p = paramEnd + 1;
         }
     }
     return queryParams_;
@@ -539,22 +598,23 @@ const std::vector<std::pair<std::string, std::string>>& URI::getQueryParams()
 
 std::string URI::toString() const
 {
-    std::stringstream s;
     std::string auth = getAuthority();
+    std::string s;
+    s.reserve( scheme_.size() + auth.size() + path_.size() + query_.size() + fragment_.size() + 5 );
     if (!scheme_.empty())
-        s << scheme_ << ":";
+        s.append( scheme_ ).append( 1, ':' );
 
     if (!auth.empty())
-        s << "//" << auth;
+        s.append( "//" ).append( auth );
     
-    s << path_;
+    s.append( path_ );
 
     if (!query_.empty())
-        s << '?' << query_;
+        s.append( 1, '?' ).append( query_ );
 
     if (!fragment_.empty())
-        s << '#' << fragment_;
-    return s.str();
+        s.append( 1, '#' ).append( fragment_ );
+    return s;
 }
 
 URI URI::trimFragment() const
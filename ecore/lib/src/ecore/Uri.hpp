@@ -112,6 +112,9 @@ namespace ecore
         URI relativize( const URI& uri ) const;
 
     private:
+        // authority parsing
+        void parseAuthority( const char* begin, const char* end );
+
         // normalization
         static URI normalize( const URI& uri );
         
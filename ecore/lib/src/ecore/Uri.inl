@@ -12,9 +12,10 @@
 #endif
 
 #include "URI.hpp"
+#include <array>
 #include <functional>
+#include <stdexcept>
 #include <tuple>
-#include <array>
 
 namespace ecore
 {
@@ -244,7 +245,19 @@ namespace std
     {
         std::size_t operator()(const ecore::URI& uri) const
         {
-            return std::hash<std::string>()(uri.toString());
+            // combine components hashes instead of hashing a rebuilt string
+            std::hash<std::string> hasher;
+            std::size_t seed = 0;
+            auto combine = [&]( std::size_t h ) { seed ^= h + 0x9e3779b9 + ( seed << 6 ) + ( seed >> 2 ); };
+            combine( hasher( uri.getScheme() ) );
+            combine( hasher( uri.getUsername() ) );
+            combine( hasher( uri.getPassword() ) );
+            combine( hasher( uri.getHost() ) );
+            combine( std::hash<uint16_t>()( uri.getPort() ) );
+            combine( hasher( uri.getPath() ) );
+            combine( hasher( uri.getQuery() ) );
+            combine( hasher( uri.getFragment() ) );
+            return seed;
         }
     };
 
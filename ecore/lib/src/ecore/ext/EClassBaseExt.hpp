@@ -13,6 +13,7 @@
 #include "ecore/impl/EClassBase.hpp"
 
 #include <unordered_map>
+#include <vector>
 
 namespace ecore::ext
 {
@@ -44,6 +45,9 @@ namespace ecore::ext
         virtual std::shared_ptr<ecore::EOperation> getOverride( const std::shared_ptr<ecore::EOperation>& operation );
        
         void setModified( int featureID );
+
+        std::size_t getClassID() const;
+        bool hasSuperType( std::size_t classID );
     
     protected:
         //*********************************
@@ -75,10 +79,14 @@ namespace ecore::ext
         void initFeaturesSubSet();
         void initNameToFeatureMap();
         void initOperationToOverrideMap();
+        void initEAllSuperTypesIDs();
 
     private:
         class ESuperAdapter;
         std::unique_ptr<ESuperAdapter> eSuperAdapter_;
+        std::size_t classID_;
+        // ids of all the super types, as a bitset indexed by class id
+        std::unique_ptr<std::vector<bool>> eAllSuperTypesIDs_;
         std::unique_ptr< std::unordered_map< std::string, std::shared_ptr<EStructuralFeature>>> nameToFeatureMap_;
         std::unique_ptr< std::unordered_map< std::shared_ptr<EOperation>, std::shared_ptr<EOperation>>> operationToOverrideMap_;
     };
@@ -69,7 +69,7 @@ namespace ecore::ext
                             auto eClassImpl = std::static_pointer_cast<EClassBaseExt>( eClass );
                             auto& subClasses = eClassImpl->eSuperAdapter_->getSubClasses();
                             auto it = std::find_if(
-                                subClasses.begin(), subClasses.end(), [=]( const auto& w ) { return w.lock() = eNotifier; } );
+                                subClasses.begin(), subClasses.end(), [=]( const auto& w ) { return w.lock() == eNotifier; } );
                             if( it != subClasses.end() )
                                 subClasses.erase( it );
                         }
@@ -119,7 +119,7 @@ namespace ecore::ext
                             auto eClassImpl = std::static_pointer_cast<EClassBaseExt>( eClass );
                             auto& subClasses = eClassImpl->eSuperAdapter_->getSubClasses();
                             auto it = std::find_if(
-                                subClasses.begin(), subClasses.end(), [=]( const auto& w ) { return w.lock() = eNotifier; } );
+                                subClasses.begin(), subClasses.end(), [=]( const auto& w ) { return w.lock() == eNotifier; } );
                             if( it != subClasses.end() )
                                 subClasses.erase( it );
                         }
@@ -136,7 +136,7 @@ namespace ecore::ext
                                 auto eClassImpl = std::static_pointer_cast<EClassBaseExt>( eClass );
                                 auto& subClasses = eClassImpl->eSuperAdapter_->getSubClasses();
                                 auto it = std::find_if(
-                                    subClasses.begin(), subClasses.end(), [=]( const auto& w ) { return w.lock() = eNotifier; } );
+                                    subClasses.begin(), subClasses.end(), [=]( const auto& w ) { return w.lock() == eNotifier; } );
                                 if( it != subClasses.end() )
                                     subClasses.erase( it );
                             }
@@ -158,6 +158,7 @@ namespace ecore::ext
     EClassBaseExt<I...>::EClassBaseExt()
         : EClassBase<I...>()
         , eSuperAdapter_( new ESuperAdapter( *this ) )
+        , classID_( EClassInternal::newClassID() )
     {
     }
 
@@ -172,12 +173,13 @@ namespace ecore::ext
     EClassBaseExt<I...>::~EClassBaseExt()
     {
         eAdapters().remove( eSuperAdapter_.get() );
+        EClassInternal::deleteClassID( classID_ );
     }
 
     template <typename... I>
     bool EClassBaseExt<I...>::isSuperTypeOf( const std::shared_ptr<ecore::EClass>& someClass )
     {
-        return someClass == getThisPtr() || someClass->getEAllSuperTypes()->contains( getThisPtr() );
+        return someClass && static_cast<EClassInternal&>( someClass->getInternal() ).hasSuperType( classID_ );
     }
 
     template <typename... I>
@@ -462,7 +464,9 @@ namespace ecore::ext
         }
         case EcorePackage::ECLASS__ESUPER_TYPES:
         {
+            EClassInternal::setSuperTypesModified();
             eAllSuperTypes_.reset();
+            eAllSuperTypesIDs_.reset();
             eAllAttributes_.reset();
             eAllOperations_.reset();
             eAllStructuralFeatures_.reset();
@@ -479,6 +483,19 @@ namespace ecore::ext
         }
     }
 
+    template <typename... I>
+    std::size_t EClassBaseExt<I...>::getClassID() const
+    {
+        return classID_;
+    }
+
+    template <typename... I>
+    bool EClassBaseExt<I...>::hasSuperType( std::size_t classID )
+    {
+        initEAllSuperTypesIDs();
+        return classID == classID_ || ( classID < eAllSuperTypesIDs_->size() && ( *eAllSuperTypesIDs_ )[classID] );
+    }
+
     template <typename... I>
     void EClassBaseExt<I...>::initFeaturesSubSet()
     {
@@ -548,6 +565,22 @@ namespace ecore::ext
         }
     }
 
+    template <typename... I>
+    void EClassBaseExt<I...>::initEAllSuperTypesIDs()
+    {
+        if( eAllSuperTypesIDs_ )
+            return;
+
+        // the bitset ends at the highest id of the super types
+        auto eAllSuperTypes = getEAllSuperTypes();
+        std::size_t size = 0;
+        for( const auto& eClass : *eAllSuperTypes )
+            size = std::max( size, static_cast<EClassInternal&>( eClass->getInternal() ).getClassID() + 1 );
+        eAllSuperTypesIDs_ = std::make_unique<std::vector<bool>>( size, false );
+        for( const auto& eClass : *eAllSuperTypes )
+            ( *eAllSuperTypesIDs_ )[static_cast<EClassInternal&>( eClass->getInternal() ).getClassID()] = true;
+    }
+
     template <typename... I>
     template <typename U>
     class EClassBaseExt<I...>::EObjectInternalAdapter : public ecore::impl::EClassBase<I...>::EObjectInternalAdapter<typename U>
@@ -563,6 +596,16 @@ namespace ecore::ext
             getObject().setModified( featureID );
         }
 
+        virtual std::size_t getClassID() const
+        {
+            return getObject().getClassID();
+        }
+
+        virtual bool hasSuperType( std::size_t classID )
+        {
+            return getObject().hasSuperType( classID );
+        }
+
         inline EClassBaseExt<I...>& getObject()
         {
             return static_cast<EClassBaseExt<I...>&>( ecore::impl::EClassBase<I...>::EObjectInternalAdapter<typename U>::getObject() );
@@ -0,0 +1,59 @@
+#include "ecore/ext/EClassInternal.hpp"
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <vector>
+
+using namespace ecore;
+using namespace ecore::ext;
+
+namespace
+{
+    // ids are allocated here, not in the class templates :
+    // classes of all the model libraries share the same id space
+    struct ClassIDs
+    {
+        std::mutex mutex_;
+        std::size_t nextClassID_{ 0 };
+        // the ids of the destroyed classes are reused : ids and super types bitsets stay bounded by the living classes
+        std::priority_queue<std::size_t, std::vector<std::size_t>, std::greater<std::size_t>> freeClassIDs_;
+    };
+
+    std::atomic<std::size_t> superTypesGeneration{ 0 };
+
+    ClassIDs& getClassIDs()
+    {
+        static ClassIDs classIDs;
+        return classIDs;
+    }
+}
+
+std::size_t EClassInternal::newClassID()
+{
+    auto& classIDs = getClassIDs();
+    std::lock_guard lock( classIDs.mutex_ );
+    if( classIDs.freeClassIDs_.empty() )
+        return classIDs.nextClassID_++;
+    auto classID = classIDs.freeClassIDs_.top();
+    classIDs.freeClassIDs_.pop();
+    return classID;
+}
+
+void EClassInternal::deleteClassID( std::size_t classID )
+{
+    auto& classIDs = getClassIDs();
+    std::lock_guard lock( classIDs.mutex_ );
+    classIDs.freeClassIDs_.push( classID );
+}
+
+std::size_t EClassInternal::getSuperTypesGeneration()
+{
+    return superTypesGeneration.load();
+}
+
+void EClassInternal::setSuperTypesModified()
+{
+    ++superTypesGeneration;
+}
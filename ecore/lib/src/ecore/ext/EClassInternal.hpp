@@ -10,8 +10,11 @@
 #ifndef ECORE_EXT_ECLASSINTERNAL_HPP
 #define ECORE_EXT_ECLASSINTERNAL_HPP
 
+#include "ecore/Exports.hpp"
 #include "ecore/impl/EClassifierInternal.hpp"
 
+#include <cstddef>
+
 namespace ecore::ext
 {
     class EClassInternal : public impl::EClassifierInternal
@@ -20,6 +23,23 @@ namespace ecore::ext
         virtual ~EClassInternal() = default;
 
         virtual void setModified( int featureID ) = 0;
+
+        // Dense id of the class, unique among the living classes of the process.
+        virtual std::size_t getClassID() const = 0;
+
+        // Returns true if the class identified by classID is this class or one of its super types.
+        virtual bool hasSuperType( std::size_t classID ) = 0;
+
+        // Allocates the id of a new class, the smallest id released by a destroyed class if any.
+        static ECORE_API std::size_t newClassID();
+
+        // Releases the id of a destroyed class.
+        static ECORE_API void deleteClassID( std::size_t classID );
+
+        // Generation of the super types of all the classes, changed each time the super types of a class change.
+        static ECORE_API std::size_t getSuperTypesGeneration();
+
+        static ECORE_API void setSuperTypesModified();
     };
 }
 
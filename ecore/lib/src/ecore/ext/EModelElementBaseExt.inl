@@ -46,12 +46,14 @@ namespace ecore::ext
     }
 
     template <typename... I>
-    std::shared_ptr<EObject> EModelElementBaseExt<I...>::eObjectForFragmentSegment(const std::string& uriFragmentSegment) const
+    std::shared_ptr<EObject> EModelElementBaseExt<I...>::eObjectForFragmentSegment(std::string_view uriSegment) const
     {
-        if (!uriFragmentSegment.empty()) {
+        if (!uriSegment.empty()) {
             // Is the first character a special character, i.e., something other than '@'?
-            char firstCharacter = uriFragmentSegment[0];
+            char firstCharacter = uriSegment[0];
             if (firstCharacter != '@') {
+                std::string uriFragmentSegment(uriSegment);
+
                 // Is it the start of a source URI of an annotation?
                 if (firstCharacter == '%') {
                     // Find the closing '%' and make sure it's not just the opening '%'
@@ -120,7 +122,7 @@ namespace ecore::ext
                 return nullptr;
             }
         }
-        return EModelElementBase<I...>::eObjectForFragmentSegment(uriFragmentSegment);
+        return EModelElementBase<I...>::eObjectForFragmentSegment(uriSegment);
     }
 
     template <typename... I>
@@ -1,13 +1,17 @@
 #include "ecore/impl/AbstractResource.hpp"
+#include "ecore/AnyCast.hpp"
 #include "ecore/EAttribute.hpp"
 #include "ecore/EClass.hpp"
 #include "ecore/ECollectionView.hpp"
+#include "ecore/ECrossReferenceAdapter.hpp"
 #include "ecore/EDiagnostic.hpp"
 #include "ecore/ENotificationChain.hpp"
 #include "ecore/ENotifyingList.hpp"
 #include "ecore/EObject.hpp"
+#include "ecore/EReference.hpp"
 #include "ecore/EResourceIDManager.hpp"
 #include "ecore/EResourceSet.hpp"
+#include "ecore/EResourceTypeIndex.hpp"
 #include "ecore/EcoreUtils.hpp"
 #include "ecore/Stream.hpp"
 #include "ecore/URIConverter.hpp"
@@ -18,8 +22,13 @@
 #include "ecore/impl/ResourceURIConverter.hpp"
 #include "ecore/impl/StringUtils.hpp"
 
+#include <algorithm>
 #include <cctype>
+#include <charconv>
+#include <deque>
 #include <sstream>
+#include <unordered_map>
+#include <unordered_set>
 
 using namespace ecore;
 using namespace ecore::impl;
@@ -59,6 +68,159 @@ private:
     int featureID_;
 };
 
+// FragmentPathCache maps already resolved fragment path prefixes to their objects.
+// It is only alive while the resource is loading : contents lists are then only
+// appended to, so a resolved prefix stays valid until the end of the load
+class AbstractResource::FragmentPathCache
+{
+public:
+    std::shared_ptr<EObject> find( std::string_view path ) const
+    {
+        auto it = objects_.find( path );
+        return it != objects_.end() ? it->second : std::shared_ptr<EObject>();
+    }
+
+    void add( std::string_view path, const std::shared_ptr<EObject>& eObject )
+    {
+        if( objects_.find( path ) == objects_.end() )
+            objects_.emplace( paths_.emplace_back( path ), eObject );
+    }
+
+private:
+    std::deque<std::string> paths_;
+    std::unordered_map<std::string_view, std::shared_ptr<EObject>> objects_;
+};
+
+// ModificationTracker records the objects of the resource modified since its last load or save,
+// in the order of their first modification. Objects are weakly referenced : the ones removed
+// from the resource are filtered when the delta is computed.
+// Its index of the cross references finds the objects referencing the contents written again in a delta
+class AbstractResource::ModificationTracker : public ECrossReferenceAdapter
+{
+public:
+    struct Modification
+    {
+        std::weak_ptr<EObject> eObject_;
+        bool isContentsModified_;
+    };
+
+public:
+    ModificationTracker( AbstractResource& resource )
+        : resource_( resource )
+    {
+    }
+
+    virtual ~ModificationTracker()
+    {
+    }
+
+    virtual void notifyChanged( const std::shared_ptr<ENotification>& notification )
+    {
+        ECrossReferenceAdapter::notifyChanged( notification );
+        if( resource_.isLoading_ )
+            return;
+
+        switch( notification->getEventType() )
+        {
+        case ENotification::SET:
+        case ENotification::UNSET:
+        case ENotification::ADD:
+        case ENotification::REMOVE:
+        case ENotification::ADD_MANY:
+        case ENotification::REMOVE_MANY:
+        case ENotification::MOVE:
+            break;
+        default:
+            return;
+        }
+
+        auto eObject = std::dynamic_pointer_cast<EObject>( notification->getNotifier() );
+        if( !eObject )
+        {
+            // the resource itself
+            if( notification->getFeatureID() == RESOURCE__CONTENTS )
+                isContentsModified_ = true;
+            return;
+        }
+
+        auto eFeature = notification->getFeature();
+        if( !eFeature || eFeature->isTransient() )
+            return;
+
+        if( auto eReference = std::dynamic_pointer_cast<EReference>( eFeature ) )
+        {
+            // the container side of a containment is not saved
+            if( !eReference->isContainer() )
+                setModified( eObject, eReference->isContainment() );
+        }
+        else if( eFeature == eObject->eClass()->getEIDAttribute() )
+        {
+            // the fragment of an object with an id is its id : it can't be found
+            // with its previous fragment, so its container contents are written again
+            if( eObject->getInternal().eInternalResource() )
+                isContentsModified_ = true;
+            else if( auto eContainer = eObject->eContainer() )
+                setModified( eContainer, true );
+        }
+        else
+            setModified( eObject, false );
+    }
+
+    bool isModified() const
+    {
+        return isContentsModified_ || !modifications_.empty();
+    }
+
+    bool isContentsModified() const
+    {
+        return isContentsModified_;
+    }
+
+    const std::vector<Modification>& getModifications() const
+    {
+        return modifications_;
+    }
+
+    void clear()
+    {
+        isContentsModified_ = false;
+        modifications_.clear();
+        indexes_.clear();
+    }
+
+    // contents may outlive the resource or its tracking
+    void removeFrom( const std::shared_ptr<EList<std::shared_ptr<EObject>>>& contents )
+    {
+        for( const auto& eObject : *contents )
+            eObject->eAdapters().remove( this );
+    }
+
+private:
+    void setModified( const std::shared_ptr<EObject>& eObject, bool isContentsModified )
+    {
+        auto [it, inserted] = indexes_.emplace( eObject.get(), modifications_.size() );
+        if( inserted )
+            modifications_.push_back( Modification{ eObject, isContentsModified } );
+        else
+        {
+            auto& modification = modifications_[it->second];
+            if( modification.eObject_.lock() != eObject )
+            {
+                // a destroyed object whose address is reused
+                modification.eObject_ = eObject;
+                modification.isContentsModified_ = false;
+            }
+            modification.isContentsModified_ |= isContentsModified;
+        }
+    }
+
+private:
+    AbstractResource& resource_;
+    bool isContentsModified_{ false };
+    std::vector<Modification> modifications_;
+    std::unordered_map<EObject*, std::size_t> indexes_;
+};
+
 AbstractResource::AbstractResource()
 {
 }
@@ -70,6 +232,8 @@ AbstractResource::AbstractResource( const URI& uri )
 
 AbstractResource::~AbstractResource()
 {
+    if( modificationTracker_ && eContents_.value() )
+        modificationTracker_->removeFrom( eContents_.get() );
 }
 
 std::shared_ptr<EResourceSet> AbstractResource::getResourceSet() const
@@ -92,6 +256,8 @@ void AbstractResource::setURI( const URI& uri )
 
 std::shared_ptr<EList<std::shared_ptr<EObject>>> AbstractResource::getContents() const
 {
+    if( pendingStream_ )
+        const_cast<AbstractResource*>( this )->loadPending();
     return eContents_;
 }
 
@@ -102,16 +268,15 @@ std::shared_ptr<const ECollectionView<std::shared_ptr<EObject>>> AbstractResourc
 
 std::shared_ptr<EObject> AbstractResource::getEObject( const std::string& uriFragment ) const
 {
+    if( pendingStream_ )
+        const_cast<AbstractResource*>( this )->loadPending();
+
     auto id = uriFragment;
     auto size = uriFragment.size();
     if( !uriFragment.empty() )
     {
         if( uriFragment.at( 0 ) == '/' )
-        {
-            auto path = split( uriFragment, "/" );
-            path.erase( path.begin() );
-            return getObjectByPath( path );
-        }
+            return getObjectByPath( std::string_view( uriFragment ).substr( 1 ) );
         else if( uriFragment.at( size - 1 ) == '?' )
         {
             auto index = uriFragment.find_last_of( '?', size - 2 );
@@ -162,25 +327,114 @@ std::string AbstractResource::getURIFragment( const std::shared_ptr<EObject>& eO
         return id;
 }
 
+std::unordered_map<EObject*, std::string> AbstractResource::getURIFragments() const
+{
+    std::unordered_map<EObject*, std::string> fragments;
+    auto contents = getContents();
+    auto isSingleRoot = contents->size() <= 1;
+    std::string path;
+    for( std::size_t i = 0; i < contents->size(); ++i )
+    {
+        path = isSingleRoot ? "/" : "/" + std::to_string( i );
+        addURIFragments( contents->get( i ), path, fragments );
+    }
+    return fragments;
+}
+
+void AbstractResource::addURIFragments( const std::shared_ptr<EObject>& eObject,
+                                        std::string& path,
+                                        std::unordered_map<EObject*, std::string>& fragments ) const
+{
+    std::string id = EcoreUtils::getID( eObject );
+    fragments.emplace( eObject.get(), id.empty() ? path : id );
+
+    auto size = path.size();
+    auto eClass = eObject->eClass();
+    for( const auto& eReference : *eClass->getEAllContainments() )
+    {
+        if( eReference->isDerived() || !eObject->eIsSet( eReference ) )
+            continue;
+
+        auto value = eObject->eGet( eReference, false );
+        if( eReference->isMany() )
+        {
+            auto l = anyListCast<std::shared_ptr<EObject>>( value );
+            for( std::size_t i = 0; i < l->size(); ++i )
+            {
+                auto eChild = l->get( i );
+                if( eChild->getInternal().eInternalResource() )
+                    continue;
+
+                path.append( "/@" ).append( eReference->getName() ).append( "." ).append( std::to_string( i ) );
+                addURIFragments( eChild, path, fragments );
+                path.resize( size );
+            }
+        }
+        else if( auto eChild = anyObjectCast<std::shared_ptr<EObject>>( value ) )
+        {
+            if( eChild->getInternal().eInternalResource() )
+                continue;
+
+            path.append( "/@" ).append( eReference->getName() );
+            addURIFragments( eChild, path, fragments );
+            path.resize( size );
+        }
+    }
+}
+
 std::string AbstractResource::getURIFragmentRootSegment( const std::shared_ptr<EObject>& eObject ) const
 {
     auto contents = eContents_.get();
     return contents->size() > 1 ? std::to_string( contents->indexOf( eObject ) ) : "";
 }
 
-std::shared_ptr<EObject> AbstractResource::getObjectByPath( const std::vector<std::string>& uriFragmentPath ) const
+std::shared_ptr<EObject> AbstractResource::getObjectByPath( std::string_view uriFragmentPath ) const
 {
-    auto eObject = getObjectForRootSegment( uriFragmentPath.empty() ? "" : uriFragmentPath[0] );
-    for( int i = 1; i < uriFragmentPath.size() && eObject; ++i )
-        eObject = eObject->getInternal().eObjectForFragmentSegment( uriFragmentPath[i] );
+    std::shared_ptr<EObject> eObject;
+    std::size_t end = std::string_view::npos;
+    if( fragmentPathCache_ )
+    {
+        // start from the longest prefix of the path already resolved
+        for( auto pos = uriFragmentPath.size(); pos != std::string_view::npos;
+             pos = pos > 0 ? uriFragmentPath.rfind( '/', pos - 1 ) : std::string_view::npos )
+        {
+            eObject = fragmentPathCache_->find( uriFragmentPath.substr( 0, pos ) );
+            if( eObject )
+            {
+                end = pos < uriFragmentPath.size() ? pos : std::string_view::npos;
+                break;
+            }
+        }
+    }
+
+    if( !eObject )
+    {
+        end = uriFragmentPath.find( '/' );
+        eObject = getObjectForRootSegment( uriFragmentPath.substr( 0, end ) );
+        if( eObject && fragmentPathCache_ )
+            fragmentPathCache_->add( uriFragmentPath.substr( 0, end ), eObject );
+    }
+
+    while( eObject && end != std::string_view::npos )
+    {
+        auto start = end + 1;
+        end = uriFragmentPath.find( '/', start );
+        eObject = eObject->getInternal().eObjectForFragmentSegment( uriFragmentPath.substr( start, end - start ) );
+        if( eObject && fragmentPathCache_ )
+            fragmentPathCache_->add( uriFragmentPath.substr( 0, end ), eObject );
+    }
     return eObject;
 }
 
 std::shared_ptr<EObject> AbstractResource::getObjectByID( const std::string& id ) const
 {
     if( resourceIDManager_ )
+    {
+        // references are resolved at the end of the load : objects are complete
+        registerDeferredObjects();
         return resourceIDManager_->getEObject( id );
-    
+    }
+
     auto allContents = std::make_shared<ECollectionView<std::shared_ptr<ecore::EObject>>>( getContents() , false );
     for( auto eObject : *allContents )
     {
@@ -191,49 +445,99 @@ std::shared_ptr<EObject> AbstractResource::getObjectByID( const std::string& id
     return std::shared_ptr<EObject>();
 }
 
-std::shared_ptr<EObject> AbstractResource::getObjectForRootSegment( const std::string& rootSegment ) const
+std::shared_ptr<EObject> AbstractResource::getObjectForRootSegment( std::string_view rootSegment ) const
 {
     int position = 0;
     if( !rootSegment.empty() )
     {
         if( rootSegment.at( 0 ) == '?' )
-            return getObjectByID( rootSegment.substr( 1 ) );
+            return getObjectByID( std::string( rootSegment.substr( 1 ) ) );
         else
-            position = std::stoi( rootSegment );
+        {
+            auto last = rootSegment.data() + rootSegment.size();
+            auto [ptr, ec] = std::from_chars( rootSegment.data(), last, position );
+            if( ec != std::errc() || ptr != last )
+                return std::shared_ptr<EObject>();
+        }
     }
     return position >= 0 && position < getContents()->size() ? getContents()->get( position ) : std::shared_ptr<EObject>();
 }
 
 void AbstractResource::attached( const std::shared_ptr<EObject>& object )
 {
+    // objects attached while loading are registered once the load is done
+    if( isRegistrationDeferred_ )
+        return;
+
     if( resourceIDManager_ )
         resourceIDManager_->registerObject( object );
+
+    if( resourceTypeIndex_ )
+        resourceTypeIndex_->registerObject( object );
 }
 
 void AbstractResource::detached( const std::shared_ptr<EObject>& object )
 {
+    if( isRegistrationDeferred_ )
+        return;
+
     if( resourceIDManager_ )
         resourceIDManager_->unregisterObject( object );
+
+    if( resourceTypeIndex_ )
+        resourceTypeIndex_->unregisterObject( object );
 }
 
 void AbstractResource::load()
+{
+    load( Options() );
+}
+
+void AbstractResource::load( std::istream& is )
+{
+    load( is, Options() );
+}
+
+void AbstractResource::load( const Options& options )
 {
     if( !isLoaded_ )
     {
         auto uriConverter = getURIConverter();
         auto is = uriConverter->createInputStream( uri_ );
         if( is )
-            load( *is );
+        {
+            if( isLoadOnDemand_ )
+            {
+                // the stream is parsed when the contents are first accessed
+                pendingStream_ = std::move( is );
+                pendingOptions_ = options;
+                auto notifications = basicSetLoaded( true, nullptr );
+                if( notifications )
+                    notifications->dispatch();
+            }
+            else
+                load( *is, options );
+        }
     }
 }
 
-void AbstractResource::load( std::istream& is )
+void AbstractResource::load( std::istream& is, const Options& options )
 {
     if( !isLoaded_ )
     {
         auto notifications = basicSetLoaded( true, nullptr );
 
-        doLoad( is );
+        beginLoad();
+        try
+        {
+            doLoad( is, options );
+        }
+        catch( ... )
+        {
+            endLoad();
+            throw;
+        }
+        endLoad();
 
         if( notifications )
             notifications->dispatch();
@@ -246,6 +550,8 @@ void AbstractResource::unload()
     {
         auto notifications = basicSetLoaded( false, nullptr );
 
+        pendingStream_.reset();
+        pendingOptions_.clear();
         doUnload();
 
         if( notifications )
@@ -258,17 +564,101 @@ bool AbstractResource::isLoaded() const
     return isLoaded_;
 }
 
+bool AbstractResource::isLoadOnDemand() const
+{
+    return isLoadOnDemand_;
+}
+
+void AbstractResource::setLoadOnDemand( bool isLoadOnDemand )
+{
+    isLoadOnDemand_ = isLoadOnDemand;
+}
+
+bool AbstractResource::isLoadPending() const
+{
+    return static_cast<bool>( pendingStream_ );
+}
+
 void AbstractResource::save()
+{
+    save( Options() );
+}
+
+void AbstractResource::save( std::ostream& os )
+{
+    save( os, Options() );
+}
+
+void AbstractResource::save( const Options& options )
 {
     auto uriConverter = getURIConverter();
     auto os = uriConverter->createOutputStream( uri_ );
     if( os )
-        save( *os );
+        save( *os, options );
 }
 
-void AbstractResource::save( std::ostream& os )
+void AbstractResource::save( std::ostream& os, const Options& options )
+{
+    doSave( os, options );
+
+    if( modificationTracker_ )
+        modificationTracker_->clear();
+}
+
+void AbstractResource::loadDelta( std::istream& is )
+{
+    loadDelta( is, Options() );
+}
+
+void AbstractResource::loadDelta( std::istream& is, const Options& options )
+{
+    doLoadDelta( is, options );
+
+    // contents are now the saved ones
+    if( modificationTracker_ )
+        modificationTracker_->clear();
+}
+
+void AbstractResource::saveDelta( std::ostream& os )
+{
+    saveDelta( os, Options() );
+}
+
+void AbstractResource::saveDelta( std::ostream& os, const Options& options )
+{
+    std::vector<ModifiedObject> modifiedObjects;
+    auto isContentsModified = getModifiedObjects( modifiedObjects );
+    doSaveDelta( os, options, isContentsModified, modifiedObjects );
+
+    if( modificationTracker_ )
+        modificationTracker_->clear();
+}
+
+bool AbstractResource::isTrackingModification() const
+{
+    return static_cast<bool>( modificationTracker_ );
+}
+
+void AbstractResource::setTrackingModification( bool isTrackingModification )
 {
-    doSave( os );
+    if( isTrackingModification == static_cast<bool>( modificationTracker_ ) )
+        return;
+
+    if( isTrackingModification )
+    {
+        modificationTracker_ = std::make_unique<ModificationTracker>( *this );
+        eAdapters().add( modificationTracker_.get() );
+    }
+    else
+    {
+        eAdapters().remove( modificationTracker_.get() );
+        modificationTracker_.reset();
+    }
+}
+
+bool AbstractResource::isModified() const
+{
+    return modificationTracker_ && modificationTracker_->isModified();
 }
 
 std::shared_ptr<EList<std::shared_ptr<EDiagnostic>>> AbstractResource::getErrors() const
@@ -291,6 +681,33 @@ void AbstractResource::setIDManager( const std::shared_ptr<EResourceIDManager>&
     resourceIDManager_ = resourceIDManager;
 }
 
+std::shared_ptr<EResourceTypeIndex> AbstractResource::getTypeIndex() const
+{
+    return resourceTypeIndex_;
+}
+
+void AbstractResource::setTypeIndex( const std::shared_ptr<EResourceTypeIndex>& resourceTypeIndex )
+{
+    resourceTypeIndex_ = resourceTypeIndex;
+
+    // the index can be installed on a resource that already has contents
+    if( resourceTypeIndex_ && !isRegistrationDeferred_ && eContents_.value() )
+    {
+        for( const auto& eObject : *getContents() )
+            resourceTypeIndex_->registerObject( eObject );
+    }
+}
+
+std::shared_ptr<EResourceStatistics> AbstractResource::getStatistics() const
+{
+    return resourceStatistics_;
+}
+
+void AbstractResource::setStatistics( const std::shared_ptr<EResourceStatistics>& resourceStatistics )
+{
+    resourceStatistics_ = resourceStatistics;
+}
+
 std::shared_ptr<ENotificationChain> AbstractResource::basicSetLoaded( bool isLoaded, const std::shared_ptr<ENotificationChain>& msgs )
 {
     auto notifications = msgs;
@@ -330,11 +747,174 @@ std::shared_ptr<ENotificationChain> AbstractResource::basicSetResourceSet( const
 
 void AbstractResource::doUnload()
 {
+    // managers are cleared at once rather than object by object
+    if( resourceIDManager_ )
+        resourceIDManager_->clear();
+    if( resourceTypeIndex_ )
+        resourceTypeIndex_->clear();
+
+    if( eContents_.value() )
+    {
+        // objects still referenced once the contents are released become proxies to their former uri,
+        // so that they are resolved again by a later load
+        auto fragments = getURIFragments();
+
+        // no notification is sent while the adapters are removed
+        std::vector<bool> delivers;
+        delivers.reserve( fragments.size() );
+        for( const auto& [eObject, fragment] : fragments )
+        {
+            delivers.push_back( eObject->eDeliver() );
+            eObject->eSetDeliver( false );
+        }
+
+        URI uri = uri_;
+        auto itDeliver = delivers.begin();
+        for( const auto& [eObject, fragment] : fragments )
+        {
+            uri.setFragment( fragment );
+            eObject->getInternal().eSetProxyURI( uri );
+            eObject->eAdapters().clear();
+            eObject->eSetDeliver( *itDeliver++ );
+        }
+    }
+    if( modificationTracker_ )
+        modificationTracker_->clear();
+
     eContents_.reset();
     errors_.reset();
     warnings_.reset();
-    if( resourceIDManager_)
-        resourceIDManager_->clear();
+}
+
+void AbstractResource::doLoadDelta( std::istream& is, const Options& options )
+{
+    getContents()->clear();
+    doLoad( is, options );
+}
+
+void AbstractResource::doSaveDelta( std::ostream& os,
+                                    const Options& options,
+                                    bool isContentsModified,
+                                    const std::vector<ModifiedObject>& modifiedObjects )
+{
+    doSave( os, options );
+}
+
+void AbstractResource::loadPending()
+{
+    // contents accessed while parsing are the ones being loaded
+    auto is = std::move( pendingStream_ );
+    auto options = std::move( pendingOptions_ );
+    pendingOptions_.clear();
+    beginLoad();
+    try
+    {
+        doLoad( *is, options );
+    }
+    catch( ... )
+    {
+        endLoad();
+        throw;
+    }
+    endLoad();
+}
+
+void AbstractResource::beginLoad()
+{
+    isLoading_ = true;
+    isRegistrationDeferred_ = true;
+    fragmentPathCache_ = std::make_unique<FragmentPathCache>();
+}
+
+void AbstractResource::endLoad()
+{
+    isLoading_ = false;
+    fragmentPathCache_.reset();
+    registerDeferredObjects();
+
+    if( modificationTracker_ )
+        modificationTracker_->clear();
+}
+
+void AbstractResource::registerDeferredObjects() const
+{
+    // register loaded objects in one pass, once their ids are set
+    if( isRegistrationDeferred_ )
+    {
+        isRegistrationDeferred_ = false;
+        if( resourceIDManager_ )
+        {
+            for( const auto& eObject : *getContents() )
+                resourceIDManager_->registerObject( eObject );
+        }
+        if( resourceTypeIndex_ )
+        {
+            for( const auto& eObject : *getContents() )
+                resourceTypeIndex_->registerObject( eObject );
+        }
+    }
+}
+
+bool AbstractResource::getModifiedObjects( std::vector<ModifiedObject>& modifiedObjects ) const
+{
+    // without tracking, the whole contents are written
+    if( !modificationTracker_ || modificationTracker_->isContentsModified() )
+        return true;
+
+    std::shared_ptr<EResource> eResource = getThisPtr();
+    auto isContentsModified = false;
+    for( const auto& modification : modificationTracker_->getModifications() )
+    {
+        auto eObject = modification.eObject_.lock();
+        if( eObject && eObject->eResource() == eResource )
+        {
+            modifiedObjects.push_back( ModifiedObject{ eObject, modification.isContentsModified_ } );
+            isContentsModified |= modification.isContentsModified_;
+        }
+    }
+    if( !isContentsModified )
+        return false;
+
+    // objects of the written subtrees are written with them
+    std::unordered_set<EObject*> eWritten;
+    std::vector<std::shared_ptr<EObject>> eWrittenObjects;
+    for( const auto& modifiedObject : modifiedObjects )
+    {
+        if( !modifiedObject.isContentsModified_ || eWritten.find( modifiedObject.eObject_.get() ) != eWritten.end() )
+            continue;
+
+        for( const auto& eObject : ECollectionView<std::shared_ptr<EObject>>( modifiedObject.eObject_, false ) )
+        {
+            if( eWritten.insert( eObject.get() ).second )
+                eWrittenObjects.push_back( eObject );
+        }
+    }
+    modifiedObjects.erase( std::remove_if( modifiedObjects.begin(),
+                                           modifiedObjects.end(),
+                                           [&]( const ModifiedObject& modifiedObject ) {
+                                               return eWritten.find( modifiedObject.eObject_.get() ) != eWritten.end();
+                                           } ),
+                           modifiedObjects.end() );
+
+    // the written subtrees are created again when the delta is loaded :
+    // the objects referencing them, found with the index of the tracker, are written so that their references are set to the new objects
+    std::unordered_set<EObject*> eModifiedObjects;
+    for( const auto& modifiedObject : modifiedObjects )
+        eModifiedObjects.insert( modifiedObject.eObject_.get() );
+
+    for( const auto& eWrittenObject : eWrittenObjects )
+    {
+        for( const auto& [eObject, eReference] : modificationTracker_->getInverseReferences( eWrittenObject ) )
+        {
+            if( eReference->isTransient() || eWritten.find( eObject.get() ) != eWritten.end()
+                || eObject->eResource() != eResource )
+                continue;
+
+            if( eModifiedObjects.insert( eObject.get() ).second )
+                modifiedObjects.push_back( ModifiedObject{ eObject, false } );
+        }
+    }
+    return false;
 }
 
 std::shared_ptr<URIConverter> AbstractResource::getURIConverter() const
@@ -16,7 +16,11 @@
 #include "ecore/impl/BasicNotifier.hpp"
 #include "ecore/impl/Lazy.hpp"
 
+#include <istream>
 #include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 namespace ecore
 {
@@ -30,6 +34,14 @@ namespace ecore::impl
 {
     class ECORE_API AbstractResource : public virtual BasicNotifier<EResource>
     {
+    public:
+        // An object to write in a delta : its features and, if its contents are modified, its whole subtree
+        struct ModifiedObject
+        {
+            std::shared_ptr<EObject> eObject_;
+            bool isContentsModified_;
+        };
+
     public:
         AbstractResource();
 
@@ -51,6 +63,9 @@ namespace ecore::impl
 
         virtual std::string getURIFragment(const std::shared_ptr<EObject>& eObject) const;
 
+        // Computes the uri fragments of all the objects contained in this resource in a single traversal of the contents.
+        virtual std::unordered_map<EObject*, std::string> getURIFragments() const;
+
         virtual void attached(const std::shared_ptr<EObject>& object);
 
         virtual void detached(const std::shared_ptr<EObject>& object);
@@ -59,14 +74,42 @@ namespace ecore::impl
 
         virtual void load(std::istream& is);
 
+        virtual void load(const Options& options);
+
+        virtual void load(std::istream& is, const Options& options);
+
         virtual void unload();
 
         virtual bool isLoaded() const;
 
+        virtual bool isLoadOnDemand() const;
+
+        virtual void setLoadOnDemand(bool isLoadOnDemand);
+
+        virtual bool isLoadPending() const;
+
         virtual void save();
 
         virtual void save(std::ostream& os);
 
+        virtual void save(const Options& options);
+
+        virtual void save(std::ostream& os, const Options& options);
+
+        virtual void loadDelta(std::istream& is);
+
+        virtual void loadDelta(std::istream& is, const Options& options);
+
+        virtual void saveDelta(std::ostream& os);
+
+        virtual void saveDelta(std::ostream& os, const Options& options);
+
+        virtual bool isTrackingModification() const;
+
+        virtual void setTrackingModification(bool isTrackingModification);
+
+        virtual bool isModified() const;
+
         virtual std::shared_ptr<EList<std::shared_ptr<EDiagnostic>>> getErrors() const;
 
         virtual std::shared_ptr<EList<std::shared_ptr<EDiagnostic>>> getWarnings() const;
@@ -75,37 +118,71 @@ namespace ecore::impl
 
         virtual void setIDManager( const std::shared_ptr<EResourceIDManager>& resourceIDManager );
 
+        virtual std::shared_ptr<EResourceTypeIndex> getTypeIndex() const;
+
+        virtual void setTypeIndex( const std::shared_ptr<EResourceTypeIndex>& resourceTypeIndex );
+
+        virtual std::shared_ptr<EResourceStatistics> getStatistics() const;
+
+        virtual void setStatistics( const std::shared_ptr<EResourceStatistics>& resourceStatistics );
+
         std::shared_ptr<ENotificationChain> basicSetLoaded(bool isLoaded, const std::shared_ptr<ENotificationChain>& notifications);
 
         std::shared_ptr<ENotificationChain> basicSetResourceSet(const std::shared_ptr<EResourceSet> resourceSet,
             const std::shared_ptr<ENotificationChain>& notifications);
 
     protected:
-        virtual void doLoad(std::istream& is) = 0;
-        virtual void doSave(std::ostream& os) = 0;
+        virtual void doLoad(std::istream& is, const Options& options) = 0;
+        virtual void doSave(std::ostream& os, const Options& options) = 0;
         virtual void doUnload();
 
+        // Formats without a delta representation read and write the whole contents
+        virtual void doLoadDelta(std::istream& is, const Options& options);
+        virtual void doSaveDelta(std::ostream& os,
+                                 const Options& options,
+                                 bool isContentsModified,
+                                 const std::vector<ModifiedObject>& modifiedObjects);
+
     private:
         std::shared_ptr<URIConverter> getURIConverter() const;
+        void loadPending();
+        void beginLoad();
+        void endLoad();
+        void registerDeferredObjects() const;
+        bool getModifiedObjects(std::vector<ModifiedObject>& modifiedObjects) const;
         std::shared_ptr<EList<std::shared_ptr<EObject>>> initContents();
         std::shared_ptr<EList<std::shared_ptr<EDiagnostic>>> initDiagnostics();
 
-        std::shared_ptr<EObject> getObjectByPath(const std::vector<std::string>& uriFragmentPath) const;
+        std::shared_ptr<EObject> getObjectByPath(std::string_view uriFragmentPath) const;
         std::shared_ptr<EObject> getObjectByID(const std::string& id) const;
-        std::shared_ptr<EObject> getObjectForRootSegment(const std::string& rootSegment) const;
+        std::shared_ptr<EObject> getObjectForRootSegment(std::string_view rootSegment) const;
         std::string getURIFragmentRootSegment(const std::shared_ptr<EObject>& eObject) const;
+        void addURIFragments( const std::shared_ptr<EObject>& eObject,
+                              std::string& path,
+                              std::unordered_map<EObject*, std::string>& fragments ) const;
         
     private:
         class Notification;
+        class FragmentPathCache;
+        class ModificationTracker;
 
     private:
         std::weak_ptr<EResourceSet> resourceSet_;
         std::shared_ptr<EResourceIDManager> resourceIDManager_;
+        std::shared_ptr<EResourceTypeIndex> resourceTypeIndex_;
+        std::shared_ptr<EResourceStatistics> resourceStatistics_;
         URI uri_;
         Lazy<std::shared_ptr<EList<std::shared_ptr<EObject>>>> eContents_{ [&]() { return initContents(); } };
         Lazy<std::shared_ptr<EList<std::shared_ptr<EDiagnostic>>>> errors_{ [&]() { return initDiagnostics(); } };
         Lazy<std::shared_ptr<EList<std::shared_ptr<EDiagnostic>>>> warnings_{ [&]() { return initDiagnostics(); } };
+        std::unique_ptr<FragmentPathCache> fragmentPathCache_;
+        std::unique_ptr<ModificationTracker> modificationTracker_;
+        std::unique_ptr<std::istream> pendingStream_;
+        Options pendingOptions_;
         bool isLoaded_{ false };
+        bool isLoading_{ false };
+        bool isLoadOnDemand_{ false };
+        mutable bool isRegistrationDeferred_{ false };
     };
 
 } // namespace ecore::impl
@@ -28,6 +28,7 @@
 #include "ecore/impl/ImmutableArrayEList.hpp"
 #include "ecore/impl/Notification.hpp"
 
+#include <charconv>
 #include <sstream>
 #include <string>
 
@@ -273,26 +274,31 @@ namespace ecore::impl
     }
 
     template <typename... I>
-    std::shared_ptr<EObject> BasicEObject<I...>::eObjectForFragmentSegment( const std::string& uriSegment ) const
+    std::shared_ptr<EObject> BasicEObject<I...>::eObjectForFragmentSegment( std::string_view uriSegment ) const
     {
-        std::size_t index = std::string::npos;
+        std::size_t index = std::string_view::npos;
         if( !uriSegment.empty() && std::isdigit( uriSegment.back() ) )
         {
             index = uriSegment.find_last_of( '.' );
-            if( index != std::string::npos )
+            if( index != std::string_view::npos )
             {
-                auto position = std::stoi( uriSegment.substr( index + 1 ) );
-                auto eFeatureName = uriSegment.substr( 1, index - 1 );
-                auto eFeature = eStructuralFeature( eFeatureName );
+                std::size_t position = 0;
+                auto first = uriSegment.data() + index + 1;
+                auto last = uriSegment.data() + uriSegment.size();
+                auto [ptr, ec] = std::from_chars( first, last, position );
+                if( ec != std::errc() || ptr != last )
+                    return std::shared_ptr<EObject>();
+
+                auto eFeature = eStructuralFeature( std::string( uriSegment.substr( 1, index - 1 ) ) );
                 auto value = eGet( eFeature, false );
                 auto list = anyListCast<std::shared_ptr<EObject>>( value );
                 if( position < list->size() )
                     return list->get( position );
             }
         }
-        if( index == std::string::npos )
+        if( index == std::string_view::npos )
         {
-            auto eFeature = eStructuralFeature( uriSegment.substr( 1 ) );
+            auto eFeature = eStructuralFeature( std::string( uriSegment.substr( 1 ) ) );
             auto value = eGet( eFeature, false );
             return anyCast<std::shared_ptr<EObject>>( value );
         }
@@ -303,18 +309,15 @@ namespace ecore::impl
     std::string BasicEObject<I...>::eURIFragmentSegment( const std::shared_ptr<EStructuralFeature>& eFeature,
                                                          const std::shared_ptr<EObject>& eObject ) const
     {
-        std::stringstream s;
-        s << "@";
-        s << eFeature->getName();
+        std::string s = "@" + eFeature->getName();
         if( eFeature->isMany() )
         {
             auto v = eGet( eFeature, false );
             auto l = anyListCast<std::shared_ptr<EObject>>( v );
             auto index = l->indexOf( eObject );
-            s << ".";
-            s << index;
+            s += "." + std::to_string( index );
         }
-        return s.str();
+        return s;
     }
 
     template <typename... I>
@@ -802,7 +805,7 @@ namespace ecore::impl
         {
             return getObject().eInternalContainer();
         }
-        virtual std::shared_ptr<EObject> eObjectForFragmentSegment( const std::string& uriSegment ) const override
+        virtual std::shared_ptr<EObject> eObjectForFragmentSegment( std::string_view uriSegment ) const override
         {
             return getObject().eObjectForFragmentSegment( uriSegment );
         }
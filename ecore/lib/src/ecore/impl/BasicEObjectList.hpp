@@ -323,6 +323,11 @@ namespace ecore::impl
                 throw "UnsupportedOperationException";
             }
 
+            virtual bool addAllUnique( std::size_t index, const Collection<ValueType>& l )
+            {
+                throw "UnsupportedOperationException";
+            }
+
             virtual ValueType move( std::size_t newIndex, std::size_t oldIndex )
             {
                 throw "UnsupportedOperationException";
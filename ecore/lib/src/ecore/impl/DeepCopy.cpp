@@ -9,6 +9,7 @@
 #include "ecore/EReference.hpp"
 #include "ecore/EStructuralFeature.hpp"
 #include "ecore/impl/EObjectInternal.hpp"
+#include "ecore/impl/ImmutableArrayEList.hpp"
 
 #include <algorithm>
 
@@ -25,6 +26,43 @@ DeepCopy::~DeepCopy()
 {
 }
 
+void DeepCopy::copyReferences()
+{
+    for( const auto& entry : objects_ )
+    {
+        const auto& eObject = entry.first;
+        const auto& copyEObject = entry.second;
+        for( const auto& reference : getCopyPlan( eObject->eClass() ).references_ )
+            copyReference( reference, eObject, copyEObject );
+    }
+}
+
+const DeepCopy::CopyPlan& DeepCopy::getCopyPlan( const std::shared_ptr<EClass>& eClass )
+{
+    auto it = plans_.find( eClass.get() );
+    if( it != plans_.end() )
+        return it->second;
+
+    CopyPlan plan;
+    for( const auto& eAttribute : eClass->getEAttributes() )
+    {
+        if( eAttribute->isChangeable() && !eAttribute->isDerived() )
+            plan.attributes_.push_back( { eAttribute, eAttribute->isMany(), false } );
+    }
+    for( const auto& eReference : eClass->getEReferences() )
+    {
+        if( !eReference->isChangeable() || eReference->isDerived() )
+            continue;
+
+        FeatureCopy reference{ eReference, eReference->isMany(), eReference->getEOpposite() != nullptr };
+        if( eReference->isContainment() )
+            plan.containments_.push_back( std::move( reference ) );
+        else if( !eReference->isContainer() )
+            plan.references_.push_back( std::move( reference ) );
+    }
+    return plans_.emplace( eClass.get(), std::move( plan ) ).first->second;
+}
+
 std::shared_ptr<EObject> DeepCopy::copy( const std::shared_ptr<EObject>& eObject )
 {
     if( eObject )
@@ -32,19 +70,14 @@ std::shared_ptr<EObject> DeepCopy::copy( const std::shared_ptr<EObject>& eObject
         auto copyEObject = createCopy( eObject );
         if( copyEObject )
         {
-            objects_[eObject] = copyEObject;
+            objects_.emplace( eObject, copyEObject );
 
-            auto eClass = eObject->eClass();
-            for( const auto& eAttribute : eClass->getEAttributes() )
-            {
-                if( eAttribute->isChangeable() && !eAttribute->isDerived() )
-                    copyAttribute( eAttribute, eObject, copyEObject );
-            }
-            for( const auto& eReference : eClass->getEReferences() )
-            {
-                if( eReference->isChangeable() && !eReference->isDerived() && eReference->isContainment() )
-                    copyContainment( eReference, eObject, copyEObject );
-            }
+            const auto& plan = getCopyPlan( eObject->eClass() );
+            for( const auto& attribute : plan.attributes_ )
+                copyAttribute( attribute, eObject, copyEObject );
+
+            for( const auto& containment : plan.containments_ )
+                copyContainment( containment, eObject, copyEObject );
 
             copyProxyURI( eObject, copyEObject );
         }
@@ -56,32 +89,20 @@ std::shared_ptr<EObject> DeepCopy::copy( const std::shared_ptr<EObject>& eObject
 std::shared_ptr<EList<std::shared_ptr<EObject>>> DeepCopy::copyAll( const std::shared_ptr<EList<std::shared_ptr<EObject>>>& l )
 {
     std::vector<std::shared_ptr<EObject>> v;
+    v.reserve( l->size() );
     std::transform( l->begin(), l->end(), std::back_inserter(v), [&]( const std::shared_ptr<EObject>& o ) { return copy( o ); } );
     return std::make_shared<ImmutableArrayEList<std::shared_ptr<EObject>>>( std::move( v ) );
 }
 
-void DeepCopy::copyReferences()
-{
-    for( const auto& entry : objects_ )
-    {
-        auto eObject = entry.first;
-        auto copyEObject = entry.second;
-        for( const auto& eReference : eObject->eClass()->getEReferences() )
-        {
-            if( eReference->isChangeable() && !eReference->isDerived() && !eReference->isContainment() && !eReference->isContainer() )
-                copyReference( eReference, eObject, copyEObject );
-        }
-    }
-}
-
-void ecore::impl::DeepCopy::copyReference( const std::shared_ptr<EReference>& eReference,
+void ecore::impl::DeepCopy::copyReference( const FeatureCopy& reference,
                                            const std::shared_ptr<EObject>& eObject,
                                            const std::shared_ptr<EObject>& copyEObject )
 {
+    const auto& eReference = reference.eFeature_;
     if( eObject->eIsSet( eReference ) )
     {
         auto value = eObject->eGet( eReference, resolve_ );
-        if( eReference->isMany() )
+        if( reference.isMany_ )
         {
             auto listSource = anyListCast<std::shared_ptr<EObject>>( value );
             auto listTarget = anyListCast<std::shared_ptr<EObject>>( copyEObject->eGet( eReference, false ) );
@@ -89,49 +110,51 @@ void ecore::impl::DeepCopy::copyReference( const std::shared_ptr<EReference>& eR
             auto target = listTarget->getUnResolvedList();
             if( source->empty() )
                 target->clear();
-            else
+            else if( reference.isBidirectional_ )
             {
-                bool isBidirectional = eReference->getEOpposite() != nullptr;
+                // opposites of already copied references may have filled the target list
                 std::size_t index = 0;
                 for( const auto& referencedObject : source )
                 {
-                    auto copyReferencedEObject = objects_[referencedObject];
-                    if( copyReferencedEObject )
+                    auto it = objects_.find( referencedObject );
+                    if( it != objects_.end() )
                     {
-                        if( isBidirectional )
-                        {
-                            auto position = target->indexOf( copyReferencedEObject );
-                            if( position == -1 )
-                                target->add( index, copyReferencedEObject );
-                            else if( index != position )
-                                target->move( index, copyReferencedEObject );
-                        }
-                        else
+                        const auto& copyReferencedEObject = it->second;
+                        auto position = target->indexOf( copyReferencedEObject );
+                        if( position == -1 )
                             target->add( index, copyReferencedEObject );
+                        else if( index != position )
+                            target->move( index, copyReferencedEObject );
                         ++index;
                     }
-                    else
-                    {
-                        if( originalReferences_ && !isBidirectional )
-                        {
-                            target->add( index, referencedObject );
-                            index++;
-                        }
-                    }
                 }
             }
+            else
+            {
+                std::vector<std::shared_ptr<EObject>> copies;
+                copies.reserve( source->size() );
+                for( const auto& referencedObject : source )
+                {
+                    auto it = objects_.find( referencedObject );
+                    if( it != objects_.end() )
+                        copies.push_back( it->second );
+                    else if( originalReferences_ )
+                        copies.push_back( referencedObject );
+                }
+                target->addAll( ImmutableArrayEList<std::shared_ptr<EObject>>( std::move( copies ) ) );
+            }
         }
         else
         {
             auto object = anyObjectCast<std::shared_ptr<EObject>>( value );
             if( object )
             {
-                auto copyReferencedEObject = objects_[object];
-                if( copyReferencedEObject )
-                    copyEObject->eSet( eReference, copyReferencedEObject );
+                auto it = objects_.find( object );
+                if( it != objects_.end() )
+                    copyEObject->eSet( eReference, it->second );
                 else
                 {
-                    if( originalReferences_ && !eReference->getEOpposite() )
+                    if( originalReferences_ && !reference.isBidirectional_ )
                         copyEObject->eSet( eReference, object );
                 }
             }
@@ -148,22 +171,23 @@ std::shared_ptr<EObject> DeepCopy::createCopy( const std::shared_ptr<EObject>& e
     return eFactory->create( eClass );
 }
 
-void DeepCopy::copyAttribute( const std::shared_ptr<EAttribute>& eAttribute,
+void DeepCopy::copyAttribute( const FeatureCopy& attribute,
                               const std::shared_ptr<EObject>& eObject,
                               const std::shared_ptr<EObject>& copyEObject ) const
 {
-    if( eObject->eIsSet( eAttribute ) )
-        copyEObject->eSet( eAttribute, eObject->eGet( eAttribute ) );
+    if( eObject->eIsSet( attribute.eFeature_ ) )
+        copyEObject->eSet( attribute.eFeature_, eObject->eGet( attribute.eFeature_ ) );
 }
 
-void DeepCopy::copyContainment( const std::shared_ptr<EReference>& eReference,
+void DeepCopy::copyContainment( const FeatureCopy& containment,
                                 const std::shared_ptr<EObject>& eObject,
                                 const std::shared_ptr<EObject>& copyEObject )
 {
+    const auto& eReference = containment.eFeature_;
     if( eObject->eIsSet( eReference ) )
     {
         auto value = eObject->eGet( eReference, resolve_ );
-        if( eReference->isMany() )
+        if( containment.isMany_ )
         {
             auto list = anyListCast<std::shared_ptr<EObject>>( value );
             copyEObject->eSet( eReference, copyAll( list ) );
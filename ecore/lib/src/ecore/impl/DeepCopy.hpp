@@ -14,12 +14,15 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 namespace ecore
 {
     class EObject;
+    class EClass;
     class EReference;
     class EAttribute;
+    class EStructuralFeature;
     template <typename T>
     class EList;
 }
@@ -38,15 +41,33 @@ namespace ecore::impl
         void copyReferences();
 
     private:
+        // how a feature is copied
+        struct FeatureCopy
+        {
+            std::shared_ptr<EStructuralFeature> eFeature_;
+            bool isMany_;
+            bool isBidirectional_;
+        };
+
+        // features of a class to copy, computed once per class
+        struct CopyPlan
+        {
+            std::vector<FeatureCopy> attributes_;
+            std::vector<FeatureCopy> containments_;
+            std::vector<FeatureCopy> references_;
+        };
+
+        const CopyPlan& getCopyPlan( const std::shared_ptr<EClass>& eClass );
+
         std::shared_ptr<EObject> createCopy( const std::shared_ptr<EObject>& eObject ) const;
-        void copyAttribute( const std::shared_ptr<EAttribute>& eAttribute,
+        void copyAttribute( const FeatureCopy& attribute,
                             const std::shared_ptr<EObject>& eObject,
                             const std::shared_ptr<EObject>& copyEObject ) const;
-        void copyContainment( const std::shared_ptr<EReference>& eReference,
+        void copyContainment( const FeatureCopy& containment,
                               const std::shared_ptr<EObject>& eObject,
                               const std::shared_ptr<EObject>& copyEObject );
         void copyProxyURI( const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EObject>& copyEObject ) const;
-        void copyReference( const std::shared_ptr<EReference>& eReference,
+        void copyReference( const FeatureCopy& reference,
                             const std::shared_ptr<EObject>& eObject,
                             const std::shared_ptr<EObject>& copyEObject );
 
@@ -54,6 +75,7 @@ namespace ecore::impl
         bool resolve_;
         bool originalReferences_;
         std::unordered_map<std::shared_ptr<EObject>, std::shared_ptr<EObject>> objects_;
+        std::unordered_map<EClass*, CopyPlan> plans_;
     };
 
 }
@@ -2,14 +2,66 @@
 #include "ecore/AnyCast.hpp"
 #include "ecore/EAttribute.hpp"
 #include "ecore/EClass.hpp"
+#include "ecore/ECollectionView.hpp"
 #include "ecore/EList.hpp"
 #include "ecore/EObject.hpp"
 #include "ecore/EReference.hpp"
+#include "ecore/EResource.hpp"
 #include "ecore/impl/EObjectInternal.hpp"
 
+#include <future>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
 using namespace ecore;
 using namespace ecore::impl;
 
+namespace
+{
+    // contents proxies are resolved and classes features computed by the calling thread,
+    // the objects are then read only while hashed
+    void prepareHash( const std::shared_ptr<EList<std::shared_ptr<EObject>>>& l )
+    {
+        std::unordered_set<EClass*> eClasses;
+        for( const auto& eObject : ECollectionView<std::shared_ptr<EObject>>( l ) )
+        {
+            auto eClass = eObject->eClass();
+            if( eClasses.insert( eClass.get() ).second )
+            {
+                eClass->getEAttributes();
+                eClass->getEReferences();
+            }
+        }
+    }
+
+    inline void combine( std::size_t& seed, std::size_t h )
+    {
+        seed ^= h + 0x9e3779b9 + ( seed << 6 ) + ( seed >> 2 );
+    }
+
+    template <typename T>
+    bool hashAs( const Any& value, std::size_t& h )
+    {
+        if( auto v = _anyCast<T>( &value ) )
+        {
+            combine( h, std::hash<T>()( *v ) );
+            return true;
+        }
+        return false;
+    }
+
+    // values of other types only contribute their type, which stays consistent with Any equality
+    std::size_t hashValue( const Any& value )
+    {
+        std::size_t h = value.type().hash_code();
+        hashAs<std::string>( value, h ) || hashAs<bool>( value, h ) || hashAs<char>( value, h ) || hashAs<short>( value, h )
+            || hashAs<int>( value, h ) || hashAs<long>( value, h ) || hashAs<long long>( value, h ) || hashAs<float>( value, h )
+            || hashAs<double>( value, h );
+        return h;
+    }
+} // namespace
+
 bool DeepEqual::equals( const std::shared_ptr<EObject>& eObj1, const std::shared_ptr<EObject>& eObj2 )
 {
     // If the first object is null, the second object must be null.
@@ -22,16 +74,16 @@ bool DeepEqual::equals( const std::shared_ptr<EObject>& eObj1, const std::shared
 
     // Both eObject1 and eObject2 are not null.
     // If eObject1 has been compared already...
-    auto eObj1Mapped = objects_[eObj1];
-    if( eObj1Mapped )
+    auto it1 = objects_.find( eObj1.get() );
+    if( it1 != objects_.end() )
         // Then eObject2 must be that previous match.
-        return eObj1Mapped == eObj2;
+        return it1->second == eObj2.get();
 
     // If eObject2 has been compared already...
-    auto eObj2Mapped = objects_[eObj2];
-    if( eObj2Mapped )
+    auto it2 = objects_.find( eObj2.get() );
+    if( it2 != objects_.end() )
         // Then eObject1 must be that match.
-        return eObj2Mapped == eObj1;
+        return it2->second == eObj1.get();
 
     // Neither eObject1 nor eObject2 have been compared yet.
 
@@ -40,8 +92,7 @@ bool DeepEqual::equals( const std::shared_ptr<EObject>& eObj1, const std::shared
     {
         // Match them and return true.
         //
-        objects_[eObj1] = eObj2;
-        objects_[eObj2] = eObj1;
+        objects_[eObj1.get()] = eObj2.get();
         return true;
     }
 
@@ -52,8 +103,8 @@ bool DeepEqual::equals( const std::shared_ptr<EObject>& eObj1, const std::shared
         auto& eObj2Internal = eObj2->getInternal();
         if( eObj1Internal.eProxyURI() == eObj2Internal.eProxyURI() )
         {
-            objects_[eObj1] = eObj2;
-            objects_[eObj2] = eObj1;
+            objects_[eObj1.get()] = eObj2.get();
+            objects_[eObj2.get()] = eObj1.get();
             return true;
         }
         else
@@ -68,16 +119,20 @@ bool DeepEqual::equals( const std::shared_ptr<EObject>& eObj1, const std::shared
     if( eClass != eObj2->eClass() )
         return false;
 
+    // If their structures differ, they can't be equal.
+    if( hash( eObj1 ) != hash( eObj2 ) )
+        return false;
+
     // Assume from now on that they match.
-    objects_[eObj1] = eObj2;
-    objects_[eObj2] = eObj1;
+    objects_[eObj1.get()] = eObj2.get();
+    objects_[eObj2.get()] = eObj1.get();
 
     for( const auto& eAttribute : eClass->getEAttributes() )
     {
         if( !eAttribute->isDerived() && !equals( eObj1, eObj2, eAttribute ) )
         {
-            objects_.erase( eObj1 );
-            objects_.erase( eObj2 );
+            objects_.erase( eObj1.get() );
+            objects_.erase( eObj2.get() );
             return false;
         }
     }
@@ -85,8 +140,8 @@ bool DeepEqual::equals( const std::shared_ptr<EObject>& eObj1, const std::shared
     {
         if( !eReference->isDerived() && !equals( eObj1, eObj2, eReference ) )
         {
-            objects_.erase( eObj1 );
-            objects_.erase( eObj2 );
+            objects_.erase( eObj1.get() );
+            objects_.erase( eObj2.get() );
             return false;
         }
     }
@@ -112,6 +167,110 @@ bool DeepEqual::equals( const std::shared_ptr<EList<std::shared_ptr<EObject>>>&
     return true;
 }
 
+bool DeepEqual::equals( const std::shared_ptr<EResource>& r1, const std::shared_ptr<EResource>& r2, bool parallel )
+{
+    if( !r1 || !r2 )
+        return r1 == r2;
+
+    // roots share the matched objects : references across roots are compared in order by this instance
+    auto l1 = r1->getContents();
+    auto l2 = r2->getContents();
+    if( parallel && !hashAll( l1, l2 ) )
+        return false;
+    return equals( l1, l2 );
+}
+
+bool DeepEqual::hashAll( const std::shared_ptr<EList<std::shared_ptr<EObject>>>& l1,
+                         const std::shared_ptr<EList<std::shared_ptr<EObject>>>& l2 )
+{
+    auto size = l1->size();
+    if( size != l2->size() )
+        return false;
+
+    prepareHash( l1 );
+    prepareHash( l2 );
+
+    // each pair of roots is hashed by its own instance, hashes are merged to be reused by the match
+    std::vector<std::future<DeepEqual>> results;
+    results.reserve( size );
+    for( std::size_t i = 0; i < size; ++i )
+        results.push_back( std::async( std::launch::async, [eObj1 = l1->get( i ), eObj2 = l2->get( i )]() {
+            DeepEqual hashes;
+            hashes.hash( eObj1 );
+            hashes.hash( eObj2 );
+            return hashes;
+        } ) );
+
+    auto result = true;
+    for( std::size_t i = 0; i < size; ++i )
+    {
+        auto hashes = results[i].get();
+        result = result && hashes.hash( l1->get( i ) ) == hashes.hash( l2->get( i ) );
+        hashes_.merge( hashes.hashes_ );
+    }
+    return result;
+}
+
+std::size_t DeepEqual::hash( const std::shared_ptr<EObject>& eObject )
+{
+    if( !eObject )
+        return 0;
+
+    auto it = hashes_.find( eObject.get() );
+    if( it != hashes_.end() )
+        return it->second;
+
+    std::size_t h = 0;
+    if( eObject->eIsProxy() )
+        h = std::hash<URI>()( eObject->getInternal().eProxyURI() );
+    else
+    {
+        // same features as the ones compared by equals
+        auto eClass = eObject->eClass();
+        h = std::hash<EClass*>()( eClass.get() );
+        for( const auto& eAttribute : eClass->getEAttributes() )
+        {
+            if( eAttribute->isDerived() )
+                continue;
+
+            auto isSet = eObject->eIsSet( eAttribute );
+            combine( h, isSet );
+            if( isSet )
+                combine( h, hashValue( eObject->eGet( eAttribute ) ) );
+        }
+        for( const auto& eReference : eClass->getEReferences() )
+        {
+            if( eReference->isDerived() )
+                continue;
+
+            auto isSet = eObject->eIsSet( eReference );
+            combine( h, isSet );
+            if( !isSet )
+                continue;
+
+            // contents contribute their own hash, cross references only their cardinality : they are not resolved
+            auto value = eObject->eGet( eReference, eReference->isContainment() );
+            if( eReference->isMany() )
+            {
+                auto l = anyListCast<std::shared_ptr<EObject>>( value );
+                combine( h, l->size() );
+                if( eReference->isContainment() )
+                {
+                    for( const auto& eChild : *l )
+                        combine( h, hash( eChild ) );
+                }
+            }
+            else
+            {
+                auto eChild = anyObjectCast<std::shared_ptr<EObject>>( value );
+                combine( h, eReference->isContainment() ? hash( eChild ) : eChild != nullptr );
+            }
+        }
+    }
+    hashes_.emplace( eObject.get(), h );
+    return h;
+}
+
 bool DeepEqual::equals( const std::shared_ptr<EObject>& eObj1,
                         const std::shared_ptr<EObject>& eObj2,
                         const std::shared_ptr<EAttribute>& eAttribute )
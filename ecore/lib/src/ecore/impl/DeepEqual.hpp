@@ -12,6 +12,7 @@
 
 #include "ecore/Exports.hpp"
 
+#include <cstddef>
 #include <memory>
 #include <unordered_map>
 
@@ -20,6 +21,7 @@ namespace ecore
     class EObject;
     class EAttribute;
     class EReference;
+    class EResource;
     template <typename T>
     class EList;
 } // namespace ecore
@@ -34,7 +36,18 @@ namespace ecore::impl
         bool equals( const std::shared_ptr<EList<std::shared_ptr<EObject>>>& lhs,
                      const std::shared_ptr<EList<std::shared_ptr<EObject>>>& rhs );
 
+        // Compares the contents of two resources. If parallel is true, the roots are hashed in parallel
+        // before being matched in order : resources must not be modified meanwhile.
+        bool equals( const std::shared_ptr<EResource>& lhs, const std::shared_ptr<EResource>& rhs, bool parallel );
+
+        // Structural hash of an object, computed bottom-up over its attributes and its contents.
+        // Equal objects have the same hash. Hashes are cached for the lifetime of this instance.
+        std::size_t hash( const std::shared_ptr<EObject>& eObject );
+
     private:
+        bool hashAll( const std::shared_ptr<EList<std::shared_ptr<EObject>>>& lhs,
+                      const std::shared_ptr<EList<std::shared_ptr<EObject>>>& rhs );
+
         bool equals( const std::shared_ptr<EObject>& lhs,
                      const std::shared_ptr<EObject>& rhs,
                      const std::shared_ptr<EAttribute>& eAttribute );
@@ -44,7 +57,8 @@ namespace ecore::impl
                      const std::shared_ptr<EReference>& eReference );
 
     private:
-        std::unordered_map<std::shared_ptr<EObject>, std::shared_ptr<EObject>> objects_;
+        std::unordered_map<EObject*, EObject*> objects_;
+        std::unordered_map<EObject*, std::size_t> hashes_;
     };
 } // namespace ecore::impl
 
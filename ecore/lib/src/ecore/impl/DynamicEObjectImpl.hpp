@@ -56,15 +56,11 @@ namespace ecore::impl
         bool isBackReference( const std::shared_ptr<EStructuralFeature>& eStructuralFeature ) const;
         bool isProxy( const std::shared_ptr<EStructuralFeature>& eStructuralFeature ) const;
 
-        void resizeProperties();
+        void resizeProperties() const;
         std::shared_ptr<EList<std::shared_ptr<EObject>>> createList( const std::shared_ptr<EStructuralFeature>& eStructuralFeature ) const;
 
         using EObjectProxy = Proxy< std::shared_ptr<EObject> >;
 
-    private:
-        class FeaturesAdapter;
-        std::unique_ptr<FeaturesAdapter> featuresAdapter_;
-
     protected:
         std::weak_ptr<EClass> eClass_;
         mutable std::vector< Any > properties_;
@@ -11,7 +11,6 @@
 #error This file may only be included from DynamicEObjectBase.hpp
 #endif
 
-#include "ecore/EAdapter.hpp"
 #include "ecore/EAttribute.hpp"
 #include "ecore/EClass.hpp"
 #include "ecore/EList.hpp"
@@ -20,7 +19,6 @@
 #include "ecore/EStructuralFeature.hpp"
 #include "ecore/EcorePackage.hpp"
 #include "ecore/Stream.hpp"
-#include "ecore/impl/AbstractAdapter.hpp"
 #include "ecore/impl/BasicEList.hpp"
 #include "ecore/impl/BasicEObjectList.hpp"
 #include "ecore/impl/Proxy.hpp"
@@ -42,43 +40,13 @@ namespace ecore::impl
 
     using EObjectProxy = Proxy<std::shared_ptr<EObject>>;
 
-    template <typename... I>
-    class DynamicEObjectBase<I...>::FeaturesAdapter : public AbstractAdapter
-    {
-    public:
-        FeaturesAdapter( DynamicEObjectBase& eObject )
-            : eObject_( eObject )
-        {
-        }
-
-        virtual ~FeaturesAdapter()
-        {
-        }
-
-        virtual void notifyChanged( const std::shared_ptr<ENotification>& notification )
-        {
-            int eventType = notification->getEventType();
-            if( eventType != ENotification::REMOVING_ADAPTER )
-            {
-                int featureID = notification->getFeatureID();
-                if( featureID == EcorePackage::ECLASS__ESTRUCTURAL_FEATURES )
-                    eObject_.resizeProperties();
-            }
-        }
-
-    private:
-        DynamicEObjectBase& eObject_;
-    };
-
     template <typename... I>
     DynamicEObjectBase<I...>::DynamicEObjectBase()
-        : featuresAdapter_( new FeaturesAdapter( *this ) )
     {
     }
 
     template <typename... I>
     DynamicEObjectBase<I...>::DynamicEObjectBase( const std::shared_ptr<EClass>& eClass )
-        : featuresAdapter_( new FeaturesAdapter( *this ) )
     {
         setEClass( eClass );
     }
@@ -86,7 +54,6 @@ namespace ecore::impl
     template <typename... I>
     DynamicEObjectBase<I...>::~DynamicEObjectBase()
     {
-        setEClass( nullptr );
     }
 
     template <typename... I>
@@ -98,14 +65,8 @@ namespace ecore::impl
     template <typename... I>
     void DynamicEObjectBase<I...>::setEClass( const std::shared_ptr<EClass>& newClass )
     {
-        if( auto eClass = eClass_.lock() )
-            eClass->eAdapters().remove( featuresAdapter_.get() );
-
         eClass_ = newClass;
         resizeProperties();
-
-        if( auto eClass = eClass_.lock() )
-            eClass->eAdapters().add( featuresAdapter_.get() );
     }
 
     template <typename... I>
@@ -126,6 +87,7 @@ namespace ecore::impl
         int dynamicFeatureID = featureID - eStaticFeatureCount();
         if( dynamicFeatureID >= 0 )
         {
+            resizeProperties();
             auto eFeature = eDynamicFeature( featureID );
             if (isContainer(eFeature)) {
                 if( eContainerFeatureID() == eFeature->getFeatureID() )
@@ -222,6 +184,7 @@ namespace ecore::impl
         int dynamicFeatureID = featureID - eStaticFeatureCount();
         if( dynamicFeatureID >= 0 )
         {
+            resizeProperties();
             auto eFeature = eDynamicFeature( featureID );
             if( isContainer( eFeature ) )
                 return eContainerFeatureID() == featureID && getInternal().eInternalContainer();
@@ -238,6 +201,7 @@ namespace ecore::impl
         int dynamicFeatureID = featureID - eStaticFeatureCount();
         if( dynamicFeatureID >= 0 )
         {
+            resizeProperties();
             auto dynamicFeature = eDynamicFeature( featureID );
             if( isContainer( dynamicFeature ) )
             {
@@ -386,6 +350,7 @@ namespace ecore::impl
         int dynamicFeatureID = featureID - eStaticFeatureCount();
         if( dynamicFeatureID >= 0 )
         {
+            resizeProperties();
             auto dynamicFeature = eDynamicFeature( featureID );
             if( isContainer( dynamicFeature ) )
             {
@@ -544,9 +509,12 @@ namespace ecore::impl
     }
 
     template <typename... I>
-    void DynamicEObjectBase<I...>::resizeProperties()
+    void DynamicEObjectBase<I...>::resizeProperties() const
     {
-        properties_.resize( eClass()->getFeatureCount() - eStaticFeatureCount() );
+        // the features of the class may have changed since the last access
+        auto size = static_cast<std::size_t>( eClass()->getFeatureCount() - eStaticFeatureCount() );
+        if( properties_.size() != size )
+            properties_.resize( size );
     }
 
     template <typename... I>
@@ -76,6 +76,12 @@ namespace ecore::impl
                 return doAddAll( index, l );
         }
 
+        virtual bool addAllUnique( std::size_t index, const Collection<ValueType>& l )
+        {
+            VERIFY( index <= size(), "out of range" );
+            return doAddAll( index, l );
+        }
+
         virtual ValueType move( std::size_t newIndex, std::size_t oldIndex )
         {
             VERIFY( newIndex <= size(), "out of range" );
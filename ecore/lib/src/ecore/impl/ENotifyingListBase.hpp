@@ -99,16 +99,14 @@ namespace ecore::impl
         virtual bool addAll( std::size_t index, const Collection<ValueType>& l )
         {
             bool result = Super::addAll( index, l );
-            auto notifications = createNotificationChain();
-            for( int i = 0; i < l.size(); ++i )
-            {
-                auto object = get( i + index );
-                notifications = inverseAdd( object, notifications );
-            }
-            createAndDispatchNotification( notifications, [&]() {
-                return l.size() == 1 ? createNotification( ENotification::ADD, NO_VALUE, toAny( l.get( 0 ) ), index )
-                                     : createNotification( ENotification::ADD_MANY, NO_VALUE, toAny( l ), index );
-            } );
+            notifyAddAll( index, l );
+            return result;
+        }
+
+        virtual bool addAllUnique( std::size_t index, const Collection<ValueType>& l )
+        {
+            bool result = Super::addAllUnique( index, l );
+            notifyAddAll( index, l );
             return result;
         }
 
@@ -186,7 +184,7 @@ namespace ecore::impl
 
                     createAndDispatchNotification( notifications, [&]() {
                         return l->size() == 1 ? createNotification( ENotification::REMOVE, toAny( l->get( 0 ) ), NO_VALUE, 0 )
-                                              : createNotification( ENotification::ADD_MANY, toAny( l ), NO_VALUE, -1 );
+                                              : createNotification( ENotification::REMOVE_MANY, toAny( l ), NO_VALUE, -1 );
                     } );
                 }
             }
@@ -297,6 +295,21 @@ namespace ecore::impl
             auto notifier = getNotifier();
             return notifier && notifier->eDeliver() && !notifier->eAdapters().empty();
         }
+
+    private:
+        void notifyAddAll( std::size_t index, const Collection<ValueType>& l )
+        {
+            auto notifications = createNotificationChain();
+            for( int i = 0; i < l.size(); ++i )
+            {
+                auto object = get( i + index );
+                notifications = inverseAdd( object, notifications );
+            }
+            createAndDispatchNotification( notifications, [&]() {
+                return l.size() == 1 ? createNotification( ENotification::ADD, NO_VALUE, toAny( l.get( 0 ) ), index )
+                                     : createNotification( ENotification::ADD_MANY, NO_VALUE, toAny( l ), index );
+            } );
+        }
     };
 } // namespace ecore::impl
 
@@ -12,6 +12,8 @@
 #include "ecore/Exports.hpp"
 #include "ecore/Uri.hpp"
 
+#include <string_view>
+
 namespace ecore
 {
     class EObject;
@@ -38,7 +40,7 @@ namespace ecore::impl
         virtual std::shared_ptr<EObject> eInternalContainer() const = 0;
 
         // URI Fragment
-        virtual std::shared_ptr<EObject> eObjectForFragmentSegment( const std::string& uriSegment ) const = 0;
+        virtual std::shared_ptr<EObject> eObjectForFragmentSegment( std::string_view uriSegment ) const = 0;
 
         virtual std::string eURIFragmentSegment( const std::shared_ptr<EStructuralFeature>& feature,
                                                  const std::shared_ptr<EObject>& eObject ) const = 0;
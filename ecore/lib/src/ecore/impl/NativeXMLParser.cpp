@@ -0,0 +1,545 @@
+#include "ecore/impl/NativeXMLParser.hpp"
+#include "ecore/EResourceStatistics.hpp"
+#include "ecore/impl/XMLNamespaces.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+using namespace ecore;
+using namespace ecore::impl;
+
+namespace
+{
+    constexpr std::size_t READ_SIZE = 64 * 1024;
+    constexpr const char* XML_PREFIX = "xml";
+    constexpr const char* XML_URI = "http://www.w3.org/XML/1998/namespace";
+    constexpr std::string_view XMLNS = "xmlns";
+
+    inline bool isSpace( char c )
+    {
+        return c == ' ' || c == '\n' || c == '\t' || c == '\r';
+    }
+
+    inline bool isNameEnd( char c )
+    {
+        return isSpace( c ) || c == '/' || c == '>' || c == '=' || c == '\0';
+    }
+
+    // the characters allowed in a document : neither the null character, the surrogates nor 0xFFFE and 0xFFFF
+    inline bool isChar( char32_t c )
+    {
+        return c >= 0x20 ? ( c < 0xD800 || ( c >= 0xE000 && c <= 0xFFFD ) || c >= 0x10000 ) : isSpace( static_cast<char>( c ) );
+    }
+
+    // writes the utf-8 encoding of c at out and returns its end
+    char* encode( char32_t c, char* out )
+    {
+        if( c < 0x80 )
+            *out++ = static_cast<char>( c );
+        else if( c < 0x800 )
+        {
+            *out++ = static_cast<char>( 0xC0 | ( c >> 6 ) );
+            *out++ = static_cast<char>( 0x80 | ( c & 0x3F ) );
+        }
+        else if( c < 0x10000 )
+        {
+            *out++ = static_cast<char>( 0xE0 | ( c >> 12 ) );
+            *out++ = static_cast<char>( 0x80 | ( ( c >> 6 ) & 0x3F ) );
+            *out++ = static_cast<char>( 0x80 | ( c & 0x3F ) );
+        }
+        else
+        {
+            *out++ = static_cast<char>( 0xF0 | ( c >> 18 ) );
+            *out++ = static_cast<char>( 0x80 | ( ( c >> 12 ) & 0x3F ) );
+            *out++ = static_cast<char>( 0x80 | ( ( c >> 6 ) & 0x3F ) );
+            *out++ = static_cast<char>( 0x80 | ( c & 0x3F ) );
+        }
+        return out;
+    }
+
+    bool isUTF8( std::string_view encoding )
+    {
+        std::string lower( encoding );
+        std::transform( lower.begin(), lower.end(), lower.begin(), []( unsigned char c ) { return static_cast<char>( std::tolower( c ) ); } );
+        return lower == "utf-8" || lower == "utf8" || lower == "us-ascii" || lower == "ascii";
+    }
+
+    class Scanner : public XMLLocator
+    {
+    public:
+        Scanner( std::string& buffer, XMLHandler& handler )
+            : handler_( handler )
+            , p_( buffer.data() )
+            , end_( buffer.data() + buffer.size() )
+            , counted_( buffer.data() )
+            , lineStart_( buffer.data() )
+        {
+        }
+
+        virtual std::string getSystemId() const
+        {
+            return std::string();
+        }
+
+        virtual int getLineNumber() const
+        {
+            countLines( p_ );
+            return line_;
+        }
+
+        virtual int getColumnNumber() const
+        {
+            countLines( p_ );
+            return static_cast<int>( p_ - lineStart_ ) + 1;
+        }
+
+        void scan()
+        {
+            handler_.setDocumentLocator( this );
+            if( !scanProlog() )
+                return;
+
+            handler_.startDocument();
+            namespaces_.pushContext();
+            namespaces_.declarePrefix( XML_PREFIX, XML_URI );
+
+            bool isRoot = false;
+            while( p_ != end_ )
+            {
+                if( *p_ != '<' )
+                {
+                    // characters are not reported
+                    auto next = static_cast<char*>( std::memchr( p_, '<', end_ - p_ ) );
+                    if( !next )
+                        next = end_;
+                    if( elements_.empty() && std::any_of( p_, next, []( char c ) { return !isSpace( c ); } ) )
+                        return fail( "Content is not allowed outside of the root element" );
+                    p_ = next;
+                }
+                else if( startsWith( "<?" ) )
+                {
+                    if( !skipPast( "?>" ) )
+                        return fail( "Unterminated processing instruction" );
+                }
+                else if( startsWith( "<!--" ) )
+                {
+                    if( !skipPast( "-->" ) )
+                        return fail( "Unterminated comment" );
+                }
+                else if( startsWith( "<![CDATA[" ) )
+                {
+                    if( elements_.empty() || !skipPast( "]]>" ) )
+                        return fail( "Invalid CDATA section" );
+                }
+                else if( startsWith( "<!DOCTYPE" ) )
+                {
+                    if( isRoot || !skipDocType() )
+                        return fail( "Invalid document type declaration" );
+                }
+                else if( startsWith( "</" ) )
+                {
+                    if( !scanEndTag() )
+                        return;
+                }
+                else
+                {
+                    if( isRoot && elements_.empty() )
+                        return fail( "Only one root element is allowed" );
+                    isRoot = true;
+                    if( !scanStartTag() )
+                        return;
+                }
+            }
+
+            if( !isRoot )
+                return fail( "The document has no root element" );
+            if( !elements_.empty() )
+                return fail( "The element '" + std::string( elements_.back() ) + "' is not closed" );
+
+            namespaces_.popContext();
+            handler_.endDocument();
+        }
+
+    private:
+        bool startsWith( std::string_view s ) const
+        {
+            return static_cast<std::size_t>( end_ - p_ ) >= s.size() && std::memcmp( p_, s.data(), s.size() ) == 0;
+        }
+
+        bool skipPast( std::string_view s )
+        {
+            auto it = std::search( p_, end_, s.begin(), s.end() );
+            if( it == end_ )
+                return false;
+            p_ = it + s.size();
+            return true;
+        }
+
+        void skipSpaces()
+        {
+            while( p_ != end_ && isSpace( *p_ ) )
+                ++p_;
+        }
+
+        std::string_view scanName()
+        {
+            auto start = p_;
+            while( p_ != end_ && !isNameEnd( *p_ ) )
+                ++p_;
+            return std::string_view( start, p_ - start );
+        }
+
+        void fail( const std::string& message )
+        {
+            handler_.error( message, getLineNumber(), getColumnNumber() );
+        }
+
+        void countLines( const char* position ) const
+        {
+            for( ; counted_ < position; ++counted_ )
+            {
+                if( *counted_ == '\n' )
+                {
+                    ++line_;
+                    lineStart_ = counted_ + 1;
+                }
+            }
+        }
+
+        // the xml declaration : only utf-8 and its ascii subset are read
+        bool scanProlog()
+        {
+            if( startsWith( "\xEF\xBB\xBF" ) )
+                p_ += 3;
+            else if( startsWith( "\xFE\xFF" ) || startsWith( "\xFF\xFE" ) )
+            {
+                fail( "Unsupported encoding : only utf-8 documents are read" );
+                return false;
+            }
+
+            if( startsWith( "<?xml" ) && p_ + 5 != end_ && isSpace( p_[5] ) )
+            {
+                auto declarationBegin = p_;
+                if( !skipPast( "?>" ) )
+                {
+                    fail( "Unterminated xml declaration" );
+                    return false;
+                }
+                std::string_view declaration( declarationBegin, p_ - declarationBegin );
+                auto index = declaration.find( "encoding" );
+                if( index != std::string_view::npos )
+                {
+                    auto quote = declaration.find_first_of( "\"'", index );
+                    auto quoteEnd = quote != std::string_view::npos ? declaration.find( declaration[quote], quote + 1 ) : quote;
+                    if( quoteEnd == std::string_view::npos || !isUTF8( declaration.substr( quote + 1, quoteEnd - quote - 1 ) ) )
+                    {
+                        fail( "Unsupported encoding : only utf-8 documents are read" );
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        bool skipDocType()
+        {
+            // the internal subset may contain '>'
+            for( int depth = 0; p_ != end_; ++p_ )
+            {
+                if( *p_ == '[' )
+                    ++depth;
+                else if( *p_ == ']' )
+                    --depth;
+                else if( *p_ == '>' && depth == 0 )
+                {
+                    ++p_;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // decodes the references and normalizes the spaces of a value in place and returns its end
+        char* decode( char* first, char* last )
+        {
+            countLines( last );
+            auto out = first;
+            for( auto in = first; in != last; )
+            {
+                if( *in == '&' )
+                {
+                    auto semicolon = static_cast<char*>( std::memchr( in, ';', last - in ) );
+                    if( !semicolon )
+                        return nullptr;
+
+                    std::string_view reference( in + 1, semicolon - in - 1 );
+                    if( reference == "lt" )
+                        *out++ = '<';
+                    else if( reference == "gt" )
+                        *out++ = '>';
+                    else if( reference == "amp" )
+                        *out++ = '&';
+                    else if( reference == "quot" )
+                        *out++ = '"';
+                    else if( reference == "apos" )
+                        *out++ = '\'';
+                    else if( reference.size() > 1 && reference[0] == '#' )
+                    {
+                        char32_t c = 0;
+                        bool isHex = reference[1] == 'x';
+                        auto digits = reference.substr( isHex ? 2 : 1 );
+                        if( digits.empty() )
+                            return nullptr;
+                        for( auto d : digits )
+                        {
+                            unsigned v;
+                            if( d >= '0' && d <= '9' )
+                                v = d - '0';
+                            else if( isHex && d >= 'a' && d <= 'f' )
+                                v = d - 'a' + 10;
+                            else if( isHex && d >= 'A' && d <= 'F' )
+                                v = d - 'A' + 10;
+                            else
+                                return nullptr;
+                            c = c * ( isHex ? 16 : 10 ) + v;
+                            if( c > 0x10FFFF )
+                                return nullptr;
+                        }
+                        if( !isChar( c ) )
+                            return nullptr;
+                        out = encode( c, out );
+                    }
+                    else
+                        return nullptr;
+                    in = semicolon + 1;
+                }
+                else if( *in == '\r' )
+                {
+                    // a line end is a single space
+                    *out++ = ' ';
+                    if( ++in != last && *in == '\n' )
+                        ++in;
+                }
+                else if( isSpace( *in ) )
+                {
+                    *out++ = ' ';
+                    ++in;
+                }
+                else
+                    *out++ = *in++;
+            }
+            return out;
+        }
+
+        // splits a qualified name and resolves its prefix, the default namespace applies to elements only
+        bool resolve( std::string_view qName, bool isElement, std::string& uri, std::string& localName )
+        {
+            auto index = qName.find( ':' );
+            if( index == std::string_view::npos )
+            {
+                localName.assign( qName );
+                if( isElement )
+                    uri = namespaces_.getURI( "" );
+                else
+                    uri.clear();
+                return true;
+            }
+            prefix_.assign( qName.substr( 0, index ) );
+            localName.assign( qName.substr( index + 1 ) );
+            uri = namespaces_.getURI( prefix_ );
+            if( uri.empty() )
+            {
+                fail( "The prefix '" + prefix_ + "' is not bound" );
+                return false;
+            }
+            return true;
+        }
+
+        bool scanStartTag()
+        {
+            ++p_;
+            auto qName = scanName();
+            if( qName.empty() )
+            {
+                fail( "Invalid element name" );
+                return false;
+            }
+
+            // attributes are read before their namespaces are known
+            rawAttributes_.clear();
+            bool isEmpty = false;
+            for( ;; )
+            {
+                auto hasSpace = p_ != end_ && isSpace( *p_ );
+                skipSpaces();
+                if( p_ == end_ )
+                {
+                    fail( "Unterminated start tag of element '" + std::string( qName ) + "'" );
+                    return false;
+                }
+                if( *p_ == '>' )
+                {
+                    ++p_;
+                    break;
+                }
+                if( startsWith( "/>" ) )
+                {
+                    p_ += 2;
+                    isEmpty = true;
+                    break;
+                }
+
+                auto name = scanName();
+                skipSpaces();
+                if( !hasSpace || name.empty() || p_ == end_ || *p_ != '=' )
+                {
+                    fail( "Invalid attribute in element '" + std::string( qName ) + "'" );
+                    return false;
+                }
+                ++p_;
+                skipSpaces();
+                if( p_ == end_ || ( *p_ != '"' && *p_ != '\'' ) )
+                {
+                    fail( "Invalid value of attribute '" + std::string( name ) + "'" );
+                    return false;
+                }
+                auto valueBegin = p_ + 1;
+                auto valueEnd = static_cast<char*>( std::memchr( valueBegin, *p_, end_ - valueBegin ) );
+                if( !valueEnd || std::memchr( valueBegin, '<', valueEnd - valueBegin ) )
+                {
+                    fail( "Invalid value of attribute '" + std::string( name ) + "'" );
+                    return false;
+                }
+                auto decodedEnd = decode( valueBegin, valueEnd );
+                if( !decodedEnd )
+                {
+                    fail( "Invalid reference in value of attribute '" + std::string( name ) + "'" );
+                    return false;
+                }
+                p_ = valueEnd + 1;
+                for( const auto& rawAttribute : rawAttributes_ )
+                {
+                    if( rawAttribute.first == name )
+                    {
+                        fail( "Attribute '" + std::string( name ) + "' is already specified in element '"
+                              + std::string( qName ) + "'" );
+                        return false;
+                    }
+                }
+                rawAttributes_.emplace_back( name, std::string_view( valueBegin, decodedEnd - valueBegin ) );
+            }
+
+            // namespaces declared by the element
+            namespaces_.pushContext();
+            for( const auto& [name, value] : rawAttributes_ )
+            {
+                if( name.substr( 0, XMLNS.size() ) != XMLNS || ( name.size() > XMLNS.size() && name[XMLNS.size()] != ':' ) )
+                    continue;
+                prefix_.assign( name.size() > XMLNS.size() ? name.substr( XMLNS.size() + 1 ) : std::string_view() );
+                value_.assign( value );
+                namespaces_.declarePrefix( prefix_, value_ );
+                handler_.startPrefixMapping( prefix_, value_ );
+            }
+
+            attributes_.clear();
+            for( const auto& [name, value] : rawAttributes_ )
+            {
+                if( name.substr( 0, XMLNS.size() ) == XMLNS && ( name.size() == XMLNS.size() || name[XMLNS.size()] == ':' ) )
+                    continue;
+                auto& attribute = attributes_.add();
+                attribute.qName_.assign( name );
+                attribute.value_.assign( value );
+                if( !resolve( name, false, attribute.uri_, attribute.localName_ ) )
+                    return false;
+                // two prefixes bound to the same namespace
+                if( !attribute.uri_.empty() && attributes_.getValue( attribute.uri_, attribute.localName_ ) != &attribute.value_ )
+                {
+                    fail( "Attribute '" + std::string( name ) + "' is already specified in element '"
+                          + std::string( qName ) + "'" );
+                    return false;
+                }
+            }
+
+            elements_.push_back( qName );
+            qName_.assign( qName );
+            if( !resolve( qName, true, uri_, localName_ ) )
+                return false;
+            handler_.startElement( uri_, localName_, qName_, attributes_ );
+            return !isEmpty || endElement();
+        }
+
+        bool scanEndTag()
+        {
+            p_ += 2;
+            auto qName = scanName();
+            skipSpaces();
+            if( p_ == end_ || *p_ != '>' )
+            {
+                fail( "Unterminated end tag of element '" + std::string( qName ) + "'" );
+                return false;
+            }
+            ++p_;
+            if( elements_.empty() || elements_.back() != qName )
+            {
+                fail( "The end tag '" + std::string( qName ) + "' doesn't match its start tag" );
+                return false;
+            }
+            return endElement();
+        }
+
+        bool endElement()
+        {
+            qName_.assign( elements_.back() );
+            if( !resolve( elements_.back(), true, uri_, localName_ ) )
+                return false;
+            elements_.pop_back();
+            handler_.endElement( uri_, localName_, qName_ );
+            namespaces_.popContext();
+            return true;
+        }
+
+    private:
+        XMLHandler& handler_;
+        char* p_;
+        char* end_;
+        mutable const char* counted_;
+        mutable const char* lineStart_;
+        mutable int line_{1};
+        XMLNamespaces namespaces_;
+        XMLAttributes attributes_;
+        std::vector<std::pair<std::string_view, std::string_view>> rawAttributes_;
+        std::vector<std::string_view> elements_;
+        std::string uri_;
+        std::string localName_;
+        std::string qName_;
+        std::string prefix_;
+        std::string value_;
+    };
+
+} // namespace
+
+void NativeXMLParser::parse( std::istream& is, XMLHandler& handler, EResourceStatistics* statistics )
+{
+    // the document is read in a single buffer where it is parsed
+    std::string buffer;
+    for( std::size_t size = 0;; )
+    {
+        buffer.resize( size + READ_SIZE );
+        is.read( buffer.data() + size, READ_SIZE );
+        auto count = static_cast<std::size_t>( is.gcount() );
+        size += count;
+        if( count < READ_SIZE )
+        {
+            buffer.resize( size );
+            break;
+        }
+    }
+    if( statistics )
+        statistics->bytesRead( buffer.size() );
+
+    Scanner scanner( buffer, handler );
+    scanner.scan();
+}
@@ -0,0 +1,33 @@
+// *****************************************************************************
+//
+// This file is part of a MASA library or program.
+// Refer to the included end-user license agreement for restrictions.
+//
+// Copyright (c) 2020 MASA Group
+//
+// *****************************************************************************
+
+#ifndef ECORE_NATIVEXMLPARSER_HPP_
+#define ECORE_NATIVEXMLPARSER_HPP_
+
+#include "ecore/Exports.hpp"
+#include "ecore/impl/XMLHandler.hpp"
+
+namespace ecore::impl
+{
+    // Parses utf-8 documents in place, once read in a single buffer : names and values are not transcoded
+    // and entities are decoded in the buffer. It checks the well-formedness of the elements but doesn't validate
+    // and skips the document type declaration.
+    class ECORE_API NativeXMLParser : public XMLParser
+    {
+    public:
+        NativeXMLParser() = default;
+
+        virtual ~NativeXMLParser() = default;
+
+        virtual void parse( std::istream& is, XMLHandler& handler, EResourceStatistics* statistics );
+    };
+
+} // namespace ecore::impl
+
+#endif
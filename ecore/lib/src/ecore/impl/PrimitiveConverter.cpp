@@ -0,0 +1,230 @@
+#include "ecore/impl/PrimitiveConverter.hpp"
+#include "ecore/AnyCast.hpp"
+#include "ecore/EDataType.hpp"
+#include "ecore/EcorePackage.hpp"
+
+#include <charconv>
+#include <chrono>
+#include <ctime>
+#include <date/date.h>
+#include <unordered_map>
+
+using namespace ecore;
+using namespace ecore::impl;
+
+namespace
+{
+    template <typename T>
+    bool parseNumber( const char* first, const char* last, T& value )
+    {
+        auto [ptr, ec] = std::from_chars( first, last, value );
+        return ec == std::errc() && ptr == last;
+    }
+
+    template <typename T>
+    bool parseNumber( const std::string& literal, T& value )
+    {
+        return parseNumber( literal.data(), literal.data() + literal.size(), value );
+    }
+
+    template <typename T>
+    void appendNumber( std::string& literal, T value )
+    {
+        char buffer[32];
+        auto [ptr, ec] = std::to_chars( buffer, buffer + sizeof( buffer ), value );
+        literal.append( buffer, ptr );
+    }
+
+    void appendDigits( std::string& literal, unsigned value, std::size_t width )
+    {
+        char buffer[16];
+        auto [ptr, ec] = std::to_chars( buffer, buffer + sizeof( buffer ), value );
+        auto size = static_cast<std::size_t>( ptr - buffer );
+        if( size < width )
+            literal.append( width - size, '0' );
+        literal.append( buffer, ptr );
+    }
+
+    // same output as std::to_string
+    bool appendFixed( std::string& literal, double value )
+    {
+        char buffer[64];
+        auto [ptr, ec] = std::to_chars( buffer, buffer + sizeof( buffer ), value, std::chars_format::fixed, 6 );
+        if( ec != std::errc() )
+            return false;
+        literal.append( buffer, ptr );
+        return true;
+    }
+
+    // dates are written as 'YYYY-MM-DDThh:mm:ss.000Z' : other layouts and fractions of seconds are left to date::parse
+    bool parseDate( const std::string& literal, std::time_t& value )
+    {
+        constexpr std::size_t SECONDS_END = 19;
+        if( literal.size() < SECONDS_END + 1 || literal.back() != 'Z' || literal[4] != '-' || literal[7] != '-' || literal[10] != 'T'
+            || literal[13] != ':' || literal[16] != ':' )
+            return false;
+
+        auto first = literal.data();
+        unsigned y, m, d, hh, mm, ss;
+        if( !parseNumber( first, first + 4, y ) || !parseNumber( first + 5, first + 7, m ) || !parseNumber( first + 8, first + 10, d )
+            || !parseNumber( first + 11, first + 13, hh ) || !parseNumber( first + 14, first + 16, mm )
+            || !parseNumber( first + 17, first + 19, ss ) )
+            return false;
+
+        auto fraction = literal.size() - 1 - SECONDS_END;
+        if( fraction > 0 && ( literal[SECONDS_END] != '.' || fraction == 1
+                              || literal.find_first_not_of( '0', SECONDS_END + 1 ) != literal.size() - 1 ) )
+            return false;
+
+        auto ymd = date::year( static_cast<int>( y ) ) / date::month( m ) / date::day( d );
+        if( !ymd.ok() || hh > 23 || mm > 59 || ss > 59 )
+            return false;
+
+        auto tp = date::sys_days( ymd ) + std::chrono::hours( hh ) + std::chrono::minutes( mm ) + std::chrono::seconds( ss );
+        value = std::chrono::system_clock::to_time_t( tp );
+        return true;
+    }
+
+    bool appendDate( std::string& literal, std::time_t value )
+    {
+        auto tp = std::chrono::time_point_cast<std::chrono::seconds>( std::chrono::system_clock::from_time_t( value ) );
+        auto days = date::floor<date::days>( tp );
+        date::year_month_day ymd( days );
+        auto y = static_cast<int>( ymd.year() );
+        if( y < 0 || y > 9999 )
+            return false;
+
+        auto seconds = ( tp - days ).count();
+        appendDigits( literal, static_cast<unsigned>( y ), 4 );
+        literal += '-';
+        appendDigits( literal, static_cast<unsigned>( ymd.month() ), 2 );
+        literal += '-';
+        appendDigits( literal, static_cast<unsigned>( ymd.day() ), 2 );
+        literal += 'T';
+        appendDigits( literal, static_cast<unsigned>( seconds / 3600 ), 2 );
+        literal += ':';
+        appendDigits( literal, static_cast<unsigned>( seconds / 60 % 60 ), 2 );
+        literal += ':';
+        appendDigits( literal, static_cast<unsigned>( seconds % 60 ), 2 );
+        literal += ".000Z";
+        return true;
+    }
+
+} // namespace
+
+PrimitiveConverter::Kind PrimitiveConverter::getKind( const std::shared_ptr<EDataType>& eDataType )
+{
+    static const std::unordered_map<EDataType*, Kind> kinds = []() {
+        auto ecorePackage = EcorePackage::eInstance();
+        return std::unordered_map<EDataType*, Kind>{ { ecorePackage->getEBoolean().get(), Kind::BOOLEAN },
+                                                     { ecorePackage->getEChar().get(), Kind::CHAR },
+                                                     { ecorePackage->getEDate().get(), Kind::DATE },
+                                                     { ecorePackage->getEDouble().get(), Kind::DOUBLE },
+                                                     { ecorePackage->getEFloat().get(), Kind::FLOAT },
+                                                     { ecorePackage->getEInt().get(), Kind::INT },
+                                                     { ecorePackage->getELong().get(), Kind::LONG },
+                                                     { ecorePackage->getEShort().get(), Kind::SHORT },
+                                                     { ecorePackage->getEString().get(), Kind::STRING } };
+    }();
+    auto it = kinds.find( eDataType.get() );
+    return it != kinds.end() ? it->second : Kind::NONE;
+}
+
+bool PrimitiveConverter::createFromString( Kind kind, const std::string& literal, Any& value )
+{
+    switch( kind )
+    {
+    case Kind::BOOLEAN:
+        value = literal == "true";
+        return true;
+    case Kind::CHAR:
+        value = literal[0];
+        return true;
+    case Kind::DATE:
+    {
+        std::time_t t;
+        if( !parseDate( literal, t ) )
+            return false;
+        value = t;
+        return true;
+    }
+    case Kind::DOUBLE:
+    {
+        double d;
+        if( !parseNumber( literal, d ) )
+            return false;
+        value = d;
+        return true;
+    }
+    case Kind::FLOAT:
+    {
+        float f;
+        if( !parseNumber( literal, f ) )
+            return false;
+        value = f;
+        return true;
+    }
+    case Kind::INT:
+    {
+        int i;
+        if( !parseNumber( literal, i ) )
+            return false;
+        value = i;
+        return true;
+    }
+    case Kind::LONG:
+    {
+        long l;
+        if( !parseNumber( literal, l ) )
+            return false;
+        value = l;
+        return true;
+    }
+    case Kind::SHORT:
+    {
+        short s;
+        if( !parseNumber( literal, s ) )
+            return false;
+        value = s;
+        return true;
+    }
+    case Kind::STRING:
+        value = literal;
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool PrimitiveConverter::convertToString( Kind kind, const Any& value, std::string& literal )
+{
+    switch( kind )
+    {
+    case Kind::BOOLEAN:
+        literal += anyCast<bool>( value ) ? "true" : "false";
+        return true;
+    case Kind::CHAR:
+        literal += anyCast<char>( value );
+        return true;
+    case Kind::DATE:
+        return appendDate( literal, anyCast<std::time_t>( value ) );
+    case Kind::DOUBLE:
+        return appendFixed( literal, anyCast<double>( value ) );
+    case Kind::FLOAT:
+        return appendFixed( literal, anyCast<float>( value ) );
+    case Kind::INT:
+        appendNumber( literal, anyCast<int>( value ) );
+        return true;
+    case Kind::LONG:
+        appendNumber( literal, anyCast<long>( value ) );
+        return true;
+    case Kind::SHORT:
+        appendNumber( literal, anyCast<short>( value ) );
+        return true;
+    case Kind::STRING:
+        literal += anyCast<const std::string&>( value );
+        return true;
+    default:
+        return false;
+    }
+}
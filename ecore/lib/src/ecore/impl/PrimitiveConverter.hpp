@@ -0,0 +1,56 @@
+// *****************************************************************************
+//
+// This file is part of a MASA library or program.
+// Refer to the included end-user license agreement for restrictions.
+//
+// Copyright (c) 2020 MASA Group
+//
+// *****************************************************************************
+
+#ifndef ECORE_PRIMITIVECONVERTER_HPP_
+#define ECORE_PRIMITIVECONVERTER_HPP_
+
+#include "ecore/Any.hpp"
+#include "ecore/Exports.hpp"
+
+#include <memory>
+#include <string>
+
+namespace ecore
+{
+    class EDataType;
+}
+
+namespace ecore::impl
+{
+    // Converts the values of the Ecore primitive data types without their factory.
+    // Literals it doesn't handle exactly as the factory does are left to it.
+    class ECORE_API PrimitiveConverter
+    {
+    public:
+        enum class Kind
+        {
+            NONE,
+            BOOLEAN,
+            CHAR,
+            DATE,
+            DOUBLE,
+            FLOAT,
+            INT,
+            LONG,
+            SHORT,
+            STRING,
+        };
+
+        static Kind getKind( const std::shared_ptr<EDataType>& eDataType );
+
+        // returns false if the literal must be converted by the factory
+        static bool createFromString( Kind kind, const std::string& literal, Any& value );
+
+        // appends the literal of value, returns false if it must be converted by the factory
+        static bool convertToString( Kind kind, const Any& value, std::string& literal );
+    };
+
+} // namespace ecore::impl
+
+#endif
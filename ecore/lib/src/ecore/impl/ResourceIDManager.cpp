@@ -1,33 +1,75 @@
 #include "ecore/impl/ResourceIDManager.hpp"
+#include "ecore/Any.hpp"
+#include "ecore/AnyCast.hpp"
+#include "ecore/EAttribute.hpp"
+#include "ecore/EClass.hpp"
+#include "ecore/ENotification.hpp"
 #include "ecore/EcoreUtils.hpp"
 #include "ecore/EObject.hpp"
 #include "ecore/EList.hpp"
+#include "ecore/impl/AbstractAdapter.hpp"
 
 using namespace ecore;
 using namespace ecore::impl;
 
+// Adapter keeps the ids up to date when the id attribute of a registered object is set or unset.
+// Containment changes are reported by the resource through registerObject and unregisterObject.
+class ResourceIDManager::Adapter : public AbstractAdapter
+{
+public:
+    Adapter( ResourceIDManager& manager )
+        : manager_( manager )
+    {
+    }
+
+    virtual void notifyChanged( const std::shared_ptr<ENotification>& notification )
+    {
+        auto eventType = notification->getEventType();
+        if( eventType == ENotification::SET || eventType == ENotification::UNSET )
+        {
+            auto eObject = std::dynamic_pointer_cast<EObject>( notification->getNotifier() );
+            if( eObject && notification->getFeature() == eObject->eClass()->getEIDAttribute() )
+                manager_.updateID( eObject );
+        }
+    }
+
+private:
+    ResourceIDManager& manager_;
+};
+
 ResourceIDManager::ResourceIDManager()
+    : adapter_( std::make_unique<Adapter>( *this ) )
 {
 }
 
 ResourceIDManager::~ResourceIDManager()
 {
+    clear();
 }
 
 void ResourceIDManager::clear()
 {
-    objectToID_.clear();
+    // registered objects may outlive this manager : they must not keep a dangling adapter
+    for( const auto& [eObject, id] : objectToID_ )
+        eObject->eAdapters().remove( adapter_.get() );
     idToObject_.clear();
+    objectToID_.clear();
 }
 
 void ResourceIDManager::registerObject( const std::shared_ptr<EObject>& eObject )
 {
-    auto id = EcoreUtils::getID( eObject );
-    if( !id.empty() )
+    // objects without id attribute have no id to follow
+    if( eObject->eClass()->getEIDAttribute() )
     {
-        objectToID_[eObject] = id;
-        idToObject_[id] = eObject;
+        auto [it, inserted] = objectToID_.emplace( eObject, computeID( eObject ) );
+        if( inserted )
+        {
+            eObject->eAdapters().add( adapter_.get() );
+            if( !it->second.empty() )
+                indexID( eObject, it->second );
+        }
     }
+
     auto contents = eObject->eContents()->getUnResolvedList();
     for( const auto& child : contents )
     {
@@ -40,8 +82,8 @@ void ResourceIDManager::unregisterObject( const std::shared_ptr<EObject>& eObjec
     auto it = objectToID_.find( eObject );
     if( it != objectToID_.end() )
     {
-        const auto& id = it->second;
-        idToObject_.erase( id );
+        eObject->eAdapters().remove( adapter_.get() );
+        unindexID( eObject, it->second );
         objectToID_.erase( it );
     }
     auto contents = eObject->eContents()->getUnResolvedList();
@@ -62,3 +104,46 @@ std::shared_ptr<EObject> ResourceIDManager::getEObject( const std::string& id )
     auto it = idToObject_.find( id );
     return it != idToObject_.end() ? it->second : nullptr;
 }
+
+void ResourceIDManager::updateID( const std::shared_ptr<EObject>& eObject )
+{
+    auto it = objectToID_.find( eObject );
+    if( it != objectToID_.end() )
+    {
+        auto& id = it->second;
+        unindexID( eObject, id );
+        id = computeID( eObject );
+        if( !id.empty() )
+            indexID( eObject, id );
+    }
+}
+
+void ResourceIDManager::indexID( const std::shared_ptr<EObject>& eObject, const std::string& id )
+{
+    // the last registered object wins : the key must then reference its id
+    auto it = idToObject_.find( id );
+    if( it != idToObject_.end() )
+        idToObject_.erase( it );
+    idToObject_.emplace( id, eObject );
+}
+
+void ResourceIDManager::unindexID( const std::shared_ptr<EObject>& eObject, const std::string& id )
+{
+    auto it = idToObject_.find( id );
+    if( it != idToObject_.end() && it->second == eObject )
+        idToObject_.erase( it );
+}
+
+std::string ResourceIDManager::computeID( const std::shared_ptr<EObject>& eObject )
+{
+    auto eIDAttribute = eObject->eClass()->getEIDAttribute();
+    if( !eIDAttribute || !eObject->eIsSet( eIDAttribute ) )
+        return std::string();
+
+    // string ids are used as is, without a round trip through the factory
+    auto value = eObject->eGet( eIDAttribute );
+    if( value.type() == typeid( std::string ) )
+        return anyCast<std::string>( value );
+
+    return EcoreUtils::convertToString( eIDAttribute->getEAttributeType(), value );
+}
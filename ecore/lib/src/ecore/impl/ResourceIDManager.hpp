@@ -13,8 +13,14 @@
 #include "ecore/EResourceIDManager.hpp"
 #include "ecore/Exports.hpp"
 
+#include <string_view>
 #include <unordered_map>
 
+namespace ecore
+{
+    class EAttribute;
+}
+
 namespace ecore::impl
 {
     class ResourceIDManager : public EResourceIDManager
@@ -35,8 +41,21 @@ namespace ecore::impl
         virtual std::shared_ptr<EObject> getEObject( const std::string& ) const;
 
     private:
+        void updateID( const std::shared_ptr<EObject>& eObject );
+        void indexID( const std::shared_ptr<EObject>& eObject, const std::string& id );
+        void unindexID( const std::shared_ptr<EObject>& eObject, const std::string& id );
+
+        static std::string computeID( const std::shared_ptr<EObject>& eObject );
+
+    private:
+        class Adapter;
+
+    private:
+        std::unique_ptr<Adapter> adapter_;
+        // registered objects and their ids : ids are stored once here,
+        // the index by id only references them
         std::unordered_map<std::shared_ptr<EObject>, std::string> objectToID_;
-        std::unordered_map<std::string, std::shared_ptr<EObject>> idToObject_;
+        std::unordered_map<std::string_view, std::shared_ptr<EObject>> idToObject_;
     };
 
 }
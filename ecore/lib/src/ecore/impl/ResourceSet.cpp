@@ -1,4 +1,7 @@
 #include "ecore/impl/ResourceSet.hpp"
+#include "ecore/AnyCast.hpp"
+#include "ecore/ENotification.hpp"
+#include "ecore/impl/AbstractAdapter.hpp"
 #include "ecore/impl/AbstractResource.hpp"
 #include "ecore/impl/BasicENotifyingList.hpp"
 #include "ecore/impl/PackageRegistry.hpp"
@@ -9,17 +12,49 @@
 using namespace ecore;
 using namespace ecore::impl;
 
+// keeps the normalized uri index up to date when the uri of a resource changes
+class ResourceSet::ResourceAdapter : public AbstractAdapter
+{
+public:
+    ResourceAdapter( ResourceSet& resourceSet )
+        : resourceSet_( resourceSet )
+    {
+    }
+
+    virtual void notifyChanged( const std::shared_ptr<ENotification>& notification )
+    {
+        if( notification->getFeatureID() == EResource::RESOURCE__URI )
+        {
+            auto resource = std::dynamic_pointer_cast<EResource>( notification->getNotifier() );
+            if( resource )
+            {
+                resourceSet_.unindexResource( anyCast<URI>( notification->getOldValue() ), resource );
+                resourceSet_.indexResource( anyCast<URI>( notification->getNewValue() ), resource );
+            }
+        }
+    }
+
+private:
+    ResourceSet& resourceSet_;
+};
 
 ResourceSet::ResourceSet()
     : resources_( [&]() { return initResources();  } )
     , uriConverter_( [&]() { return std::make_shared<ResourceURIConverter>(); } )
     , resourceFactoryRegistry_([&]() { return EResourceFactoryRegistry::getInstance(); })
     , packageRegistry_([&]() { return std::make_shared<PackageRegistry>( EPackageRegistry::getInstance()); })
+    , resourceAdapter_( std::make_unique<ResourceAdapter>( *this ) )
 {
 }
 
 ResourceSet::~ResourceSet()
 {
+    // resources may outlive this resource set : they must not keep a dangling adapter
+    if( auto resources = resources_.value() )
+    {
+        for( const auto& resource : *resources )
+            resource->eAdapters().remove( resourceAdapter_.get() );
+    }
 }
 
 std::shared_ptr<EResource> ResourceSet::createResource(const URI& uri)
@@ -41,24 +76,23 @@ std::shared_ptr<EList<std::shared_ptr<EResource>>> ResourceSet::getResources() c
 std::shared_ptr<EResource> ResourceSet::getResource(const URI& uri, bool loadOnDemand)
 {
     if (uriResourceMap_.has_value()) {
-        auto resource = uriResourceMap_->at(uri);
-        if (resource) {
+        auto it = uriResourceMap_->find(uri);
+        if (it != uriResourceMap_->end() && it->second) {
+            auto resource = it->second;
             if (loadOnDemand && !resource->isLoaded())
                 resource->load();
             return resource;
         }
     }
-        
-    auto normalizedURI = uriConverter_->normalize(uri);
-    for (auto resource : resources_.get()) {
-        auto resourceURI = uriConverter_->normalize(resource->getURI());
-        if (resourceURI == normalizedURI) {
-            if (loadOnDemand && !resource->isLoaded())
-                resource->load();
-            if (uriResourceMap_.has_value())
-                uriResourceMap_->insert({ uri, resource });
-            return resource;
-        }
+
+    auto it = normalizedURIToResource_.find(uriConverter_->normalize(uri));
+    if (it != normalizedURIToResource_.end()) {
+        auto resource = it->second;
+        if (loadOnDemand && !resource->isLoaded())
+            resource->load();
+        if (uriResourceMap_.has_value())
+            uriResourceMap_->insert({ uri, resource });
+        return resource;
     }
 
     if (loadOnDemand) {
@@ -85,6 +119,7 @@ std::shared_ptr<URIConverter> ResourceSet::getURIConverter() const
 void ResourceSet::setURIConverter( const std::shared_ptr<URIConverter>& uriConverter )
 {
     uriConverter_ = uriConverter;
+    reindexResources();
 }
 
 std::shared_ptr<EResourceFactoryRegistry> ResourceSet::getResourceFactoryRegistry() const
@@ -117,6 +152,54 @@ std::unordered_map<URI, std::shared_ptr<EResource>> ecore::impl::ResourceSet::ge
     return uriResourceMap_.has_value() ? uriResourceMap_.value() : std::unordered_map<URI, std::shared_ptr<EResource>>();
 }
 
+void ResourceSet::attachResource( const std::shared_ptr<EResource>& resource )
+{
+    indexResource( resource->getURI(), resource );
+    resource->eAdapters().add( resourceAdapter_.get() );
+}
+
+void ResourceSet::detachResource( const std::shared_ptr<EResource>& resource )
+{
+    resource->eAdapters().remove( resourceAdapter_.get() );
+    unindexResource( resource->getURI(), resource );
+}
+
+void ResourceSet::indexResource( const URI& uri, const std::shared_ptr<EResource>& resource )
+{
+    // first registered resource wins, as with a sequential lookup
+    normalizedURIToResource_.emplace( uriConverter_->normalize( uri ), resource );
+}
+
+void ResourceSet::unindexResource( const URI& uri, const std::shared_ptr<EResource>& resource )
+{
+    auto normalizedURI = uriConverter_->normalize( uri );
+    auto it = normalizedURIToResource_.find( normalizedURI );
+    if( it == normalizedURIToResource_.end() || it->second != resource )
+        return;
+
+    normalizedURIToResource_.erase( it );
+
+    // another resource may share the same uri
+    for( const auto& other : *resources_.get() )
+    {
+        if( other != resource && uriConverter_->normalize( other->getURI() ) == normalizedURI )
+        {
+            normalizedURIToResource_.emplace( normalizedURI, other );
+            break;
+        }
+    }
+}
+
+void ResourceSet::reindexResources()
+{
+    normalizedURIToResource_.clear();
+    if( auto resources = resources_.value() )
+    {
+        for( const auto& resource : *resources )
+            indexResource( resource->getURI(), resource );
+    }
+}
+
 std::shared_ptr<EList<std::shared_ptr<EResource>>> ResourceSet::initResources()
 {
     class ResourcesEList : public BasicENotifyingList<std::shared_ptr<EResource>>
@@ -141,6 +224,7 @@ std::shared_ptr<EList<std::shared_ptr<EResource>>> ResourceSet::initResources()
         virtual std::shared_ptr<ENotificationChain> inverseAdd( const std::shared_ptr<EResource>& object
                                                               , const std::shared_ptr<ENotificationChain>& notifications ) const
         {
+            resourceSet_.attachResource( object );
             auto resource = std::dynamic_pointer_cast<AbstractResource>( object );
             return resource ? resource->basicSetResourceSet( resourceSet_.getThisPtr(), notifications ) : notifications;
         }
@@ -148,6 +232,7 @@ std::shared_ptr<EList<std::shared_ptr<EResource>>> ResourceSet::initResources()
         virtual std::shared_ptr<ENotificationChain> inverseRemove( const std::shared_ptr<EResource>& object
                                                                  , const std::shared_ptr<ENotificationChain>& notifications ) const
         {
+            resourceSet_.detachResource( object );
             auto resource = std::dynamic_pointer_cast<AbstractResource>( object );
             return resource ? resource->basicSetResourceSet( nullptr, notifications ) : notifications;
         }
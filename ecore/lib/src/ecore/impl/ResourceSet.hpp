@@ -17,6 +17,7 @@
 #include "ecore/impl/Lazy.hpp"
 
 #include <optional>
+#include <unordered_map>
 
 namespace ecore::impl
 {
@@ -47,6 +48,16 @@ namespace ecore::impl
 
     private:
         std::shared_ptr<EList<std::shared_ptr<EResource>>> initResources();
+
+        void attachResource( const std::shared_ptr<EResource>& resource );
+        void detachResource( const std::shared_ptr<EResource>& resource );
+
+        void indexResource( const URI& uri, const std::shared_ptr<EResource>& resource );
+        void unindexResource( const URI& uri, const std::shared_ptr<EResource>& resource );
+        void reindexResources();
+
+    private:
+        class ResourceAdapter;
      
     private:
         Lazy<std::shared_ptr<EList<std::shared_ptr<EResource>>>> resources_;
@@ -54,6 +65,8 @@ namespace ecore::impl
         Lazy<std::shared_ptr<EResourceFactoryRegistry>> resourceFactoryRegistry_;
         Lazy<std::shared_ptr<EPackageRegistry>> packageRegistry_;
         std::optional<std::unordered_map<URI, std::shared_ptr<EResource>>> uriResourceMap_;
+        std::unordered_map<URI, std::shared_ptr<EResource>> normalizedURIToResource_;
+        std::unique_ptr<ResourceAdapter> resourceAdapter_;
     };
 
 }
@@ -0,0 +1,172 @@
+#include "ecore/impl/ResourceStatistics.hpp"
+#include "ecore/EClass.hpp"
+
+#include <algorithm>
+#include <ostream>
+#include <vector>
+
+using namespace ecore;
+using namespace ecore::impl;
+
+namespace
+{
+    constexpr const char* PHASE_NAMES[] = { "parse", "namespaces", "handleReferences", "serialize", "write" };
+}
+
+void ResourceStatistics::elementParsed()
+{
+    ++elementCount_;
+}
+
+void ResourceStatistics::objectCreated( const std::shared_ptr<EClass>& eClass )
+{
+    ++objectCount_;
+    auto [it, inserted] = classes_.emplace( eClass.get(), ClassStatistics{ std::string(), 0 } );
+    if( inserted )
+        it->second.name_ = eClass->getName();
+    ++it->second.objectCount_;
+}
+
+void ResourceStatistics::attributeConverted()
+{
+    ++attributeConversionCount_;
+}
+
+void ResourceStatistics::referenceDeferred()
+{
+    ++deferredReferenceCount_;
+}
+
+void ResourceStatistics::referenceResolved()
+{
+    ++resolvedReferenceCount_;
+}
+
+void ResourceStatistics::proxyCreated()
+{
+    ++proxyCount_;
+}
+
+void ResourceStatistics::bytesRead( std::size_t count )
+{
+    bytesRead_ += count;
+}
+
+void ResourceStatistics::bytesWritten( std::size_t count )
+{
+    bytesWritten_ += count;
+}
+
+void ResourceStatistics::phaseEnded( Phase phase, std::chrono::nanoseconds duration )
+{
+    durations_[static_cast<std::size_t>( phase )] += duration;
+}
+
+void ResourceStatistics::clear()
+{
+    *this = ResourceStatistics();
+}
+
+void ResourceStatistics::report( EResourceStatistics& statistics ) const
+{
+    for( std::size_t i = 0; i < elementCount_; ++i )
+        statistics.elementParsed();
+    for( std::size_t i = 0; i < attributeConversionCount_; ++i )
+        statistics.attributeConverted();
+    for( std::size_t i = 0; i < deferredReferenceCount_; ++i )
+        statistics.referenceDeferred();
+    for( std::size_t i = 0; i < resolvedReferenceCount_; ++i )
+        statistics.referenceResolved();
+    for( std::size_t i = 0; i < proxyCount_; ++i )
+        statistics.proxyCreated();
+    if( bytesRead_ )
+        statistics.bytesRead( bytesRead_ );
+    if( bytesWritten_ )
+        statistics.bytesWritten( bytesWritten_ );
+}
+
+std::size_t ResourceStatistics::getElementCount() const
+{
+    return elementCount_;
+}
+
+std::size_t ResourceStatistics::getObjectCount() const
+{
+    return objectCount_;
+}
+
+std::size_t ResourceStatistics::getObjectCount( const std::shared_ptr<EClass>& eClass ) const
+{
+    auto it = classes_.find( eClass.get() );
+    return it != classes_.end() ? it->second.objectCount_ : 0;
+}
+
+std::size_t ResourceStatistics::getAttributeConversionCount() const
+{
+    return attributeConversionCount_;
+}
+
+std::size_t ResourceStatistics::getDeferredReferenceCount() const
+{
+    return deferredReferenceCount_;
+}
+
+std::size_t ResourceStatistics::getResolvedReferenceCount() const
+{
+    return resolvedReferenceCount_;
+}
+
+std::size_t ResourceStatistics::getProxyCount() const
+{
+    return proxyCount_;
+}
+
+std::size_t ResourceStatistics::getBytesRead() const
+{
+    return bytesRead_;
+}
+
+std::size_t ResourceStatistics::getBytesWritten() const
+{
+    return bytesWritten_;
+}
+
+std::chrono::nanoseconds ResourceStatistics::getDuration( Phase phase ) const
+{
+    return durations_[static_cast<std::size_t>( phase )];
+}
+
+void ResourceStatistics::save( std::ostream& os ) const
+{
+    // classes are sorted by name for the output to be stable
+    std::vector<const ClassStatistics*> classes;
+    classes.reserve( classes_.size() );
+    for( const auto& [eClass, classStatistics] : classes_ )
+        classes.push_back( &classStatistics );
+    std::sort( classes.begin(), classes.end(), []( const auto* lhs, const auto* rhs ) { return lhs->name_ < rhs->name_; } );
+
+    os << "{\"elements\":" << elementCount_;
+    os << ",\"objects\":" << objectCount_;
+    os << ",\"objectsPerClass\":[";
+    for( std::size_t i = 0; i < classes.size(); ++i )
+    {
+        if( i > 0 )
+            os << ",";
+        os << "{\"class\":\"" << classes[i]->name_ << "\",\"count\":" << classes[i]->objectCount_ << "}";
+    }
+    os << "]";
+    os << ",\"attributeConversions\":" << attributeConversionCount_;
+    os << ",\"referencesDeferred\":" << deferredReferenceCount_;
+    os << ",\"referencesResolved\":" << resolvedReferenceCount_;
+    os << ",\"proxies\":" << proxyCount_;
+    os << ",\"bytesRead\":" << bytesRead_;
+    os << ",\"bytesWritten\":" << bytesWritten_;
+    os << ",\"durations\":{";
+    for( std::size_t i = 0; i < durations_.size(); ++i )
+    {
+        if( i > 0 )
+            os << ",";
+        os << "\"" << PHASE_NAMES[i] << "\":" << durations_[i].count();
+    }
+    os << "}}";
+}
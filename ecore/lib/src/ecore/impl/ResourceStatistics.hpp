@@ -0,0 +1,148 @@
+// *****************************************************************************
+//
+// This file is part of a MASA library or program.
+// Refer to the included end-user license agreement for restrictions.
+//
+// Copyright (c) 2020 MASA Group
+//
+// *****************************************************************************
+
+#ifndef ECORE_RESOURCESTATISTICS_HPP_
+#define ECORE_RESOURCESTATISTICS_HPP_
+
+#include "ecore/EResourceStatistics.hpp"
+#include "ecore/Exports.hpp"
+
+#include <array>
+#include <iosfwd>
+#include <string>
+#include <unordered_map>
+
+namespace ecore::impl
+{
+    // Sums the events of the loads and saves of the resources it is set on.
+    class ECORE_API ResourceStatistics : public EResourceStatistics
+    {
+    public:
+        ResourceStatistics() = default;
+
+        virtual ~ResourceStatistics() = default;
+
+        virtual void elementParsed();
+
+        virtual void objectCreated( const std::shared_ptr<EClass>& eClass );
+
+        virtual void attributeConverted();
+
+        virtual void referenceDeferred();
+
+        virtual void referenceResolved();
+
+        virtual void proxyCreated();
+
+        virtual void bytesRead( std::size_t count );
+
+        virtual void bytesWritten( std::size_t count );
+
+        virtual void phaseEnded( Phase phase, std::chrono::nanoseconds duration );
+
+        void clear();
+
+        // Reports the counts summed by these statistics to others. Durations are not reported,
+        // neither are the created objects whose classes are not kept.
+        void report( EResourceStatistics& statistics ) const;
+
+        std::size_t getElementCount() const;
+
+        std::size_t getObjectCount() const;
+
+        std::size_t getObjectCount( const std::shared_ptr<EClass>& eClass ) const;
+
+        std::size_t getAttributeConversionCount() const;
+
+        std::size_t getDeferredReferenceCount() const;
+
+        std::size_t getResolvedReferenceCount() const;
+
+        std::size_t getProxyCount() const;
+
+        std::size_t getBytesRead() const;
+
+        std::size_t getBytesWritten() const;
+
+        std::chrono::nanoseconds getDuration( Phase phase ) const;
+
+        // Writes the statistics as a json object, durations in nanoseconds.
+        void save( std::ostream& os ) const;
+
+    private:
+        struct ClassStatistics
+        {
+            std::string name_;
+            std::size_t objectCount_;
+        };
+
+        std::size_t elementCount_{ 0 };
+        std::size_t objectCount_{ 0 };
+        std::size_t attributeConversionCount_{ 0 };
+        std::size_t deferredReferenceCount_{ 0 };
+        std::size_t resolvedReferenceCount_{ 0 };
+        std::size_t proxyCount_{ 0 };
+        std::size_t bytesRead_{ 0 };
+        std::size_t bytesWritten_{ 0 };
+        std::array<std::chrono::nanoseconds, 5> durations_{};
+        std::unordered_map<EClass*, ClassStatistics> classes_;
+    };
+
+    // Reports the duration of a phase when destroyed, the clock is not read without statistics.
+    // The timer of the enclosing phase of the thread is paused meanwhile : phases are exclusive.
+    class PhaseTimer
+    {
+    public:
+        PhaseTimer( EResourceStatistics* statistics, EResourceStatistics::Phase phase )
+            : statistics_( statistics )
+            , phase_( phase )
+        {
+            // only the timers with statistics are linked : the others don't touch the thread local
+            if( statistics_ )
+            {
+                start_ = std::chrono::steady_clock::now();
+                parent_ = current();
+                if( parent_ )
+                    parent_->statistics_->phaseEnded( parent_->phase_, start_ - parent_->start_ );
+                current() = this;
+            }
+        }
+
+        ~PhaseTimer()
+        {
+            if( statistics_ )
+            {
+                current() = parent_;
+                auto end = std::chrono::steady_clock::now();
+                statistics_->phaseEnded( phase_, end - start_ );
+                if( parent_ )
+                    parent_->start_ = end;
+            }
+        }
+
+        PhaseTimer( const PhaseTimer& ) = delete;
+        PhaseTimer& operator=( const PhaseTimer& ) = delete;
+
+    private:
+        static PhaseTimer*& current()
+        {
+            thread_local PhaseTimer* current = nullptr;
+            return current;
+        }
+
+    private:
+        EResourceStatistics* statistics_;
+        EResourceStatistics::Phase phase_;
+        PhaseTimer* parent_{ nullptr };
+        std::chrono::steady_clock::time_point start_;
+    };
+
+}
+
+#endif
@@ -0,0 +1,113 @@
+#include "ecore/impl/ResourceTypeIndex.hpp"
+#include "ecore/EClass.hpp"
+#include "ecore/EList.hpp"
+#include "ecore/EObject.hpp"
+#include "ecore/ext/EClassInternal.hpp"
+
+using namespace ecore;
+using namespace ecore::impl;
+
+void ResourceTypeIndex::clear()
+{
+    subClassIDs_.clear();
+    positions_.clear();
+    classIDs_.clear();
+    instances_.clear();
+}
+
+void ResourceTypeIndex::registerObject( const std::shared_ptr<EObject>& eObject )
+{
+    auto classID = getClassID( eObject->eClass() );
+    auto& eObjects = instances_[classID].eObjects_;
+    if( positions_.emplace( eObject.get(), std::make_pair( classID, eObjects.size() ) ).second )
+        eObjects.push_back( eObject );
+
+    auto contents = eObject->eContents()->getUnResolvedList();
+    for( const auto& child : contents )
+    {
+        registerObject( child );
+    }
+}
+
+void ResourceTypeIndex::unregisterObject( const std::shared_ptr<EObject>& eObject )
+{
+    auto it = positions_.find( eObject.get() );
+    if( it != positions_.end() )
+    {
+        // move the last instance of the class in place of the removed one
+        auto [classID, position] = it->second;
+        auto& eObjects = instances_[classID].eObjects_;
+        if( position != eObjects.size() - 1 )
+        {
+            eObjects[position] = std::move( eObjects.back() );
+            positions_[eObjects[position].get()].second = position;
+        }
+        eObjects.pop_back();
+        positions_.erase( it );
+    }
+    auto contents = eObject->eContents()->getUnResolvedList();
+    for( const auto& child : contents )
+    {
+        unregisterObject( child );
+    }
+}
+
+std::vector<std::shared_ptr<EObject>> ResourceTypeIndex::getInstances( const std::shared_ptr<EClass>& eClass ) const
+{
+    std::vector<std::shared_ptr<EObject>> result;
+    if( !eClass )
+        return result;
+
+    const auto& classIDs = getSubClassIDs( eClass );
+    std::size_t size = 0;
+    for( auto classID : classIDs )
+        size += instances_[classID].eObjects_.size();
+
+    result.reserve( size );
+    for( auto classID : classIDs )
+    {
+        const auto& eObjects = instances_[classID].eObjects_;
+        result.insert( result.end(), eObjects.begin(), eObjects.end() );
+    }
+    return result;
+}
+
+std::size_t ResourceTypeIndex::getClassID( const std::shared_ptr<EClass>& eClass )
+{
+    auto [it, inserted] = classIDs_.emplace( eClass.get(), instances_.size() );
+    if( inserted )
+    {
+        instances_.push_back( Instances{ eClass, {} } );
+
+        // the sub classes already computed are completed with the new class
+        for( auto& [key, subClasses] : subClassIDs_ )
+        {
+            if( subClasses.eClass_->isSuperTypeOf( eClass ) )
+                subClasses.classIDs_.push_back( it->second );
+        }
+    }
+    return it->second;
+}
+
+const std::vector<std::size_t>& ResourceTypeIndex::getSubClassIDs( const std::shared_ptr<EClass>& eClass ) const
+{
+    // the sub classes are computed again once the super types of a class changed
+    auto superTypesGeneration = ext::EClassInternal::getSuperTypesGeneration();
+    if( superTypesGeneration != superTypesGeneration_ )
+    {
+        subClassIDs_.clear();
+        superTypesGeneration_ = superTypesGeneration;
+    }
+
+    auto [it, inserted] = subClassIDs_.emplace( eClass.get(), SubClasses{ eClass, {} } );
+    if( inserted )
+    {
+        auto& classIDs = it->second.classIDs_;
+        for( std::size_t classID = 0; classID < instances_.size(); ++classID )
+        {
+            if( eClass->isSuperTypeOf( instances_[classID].eClass_ ) )
+                classIDs.push_back( classID );
+        }
+    }
+    return it->second.classIDs_;
+}
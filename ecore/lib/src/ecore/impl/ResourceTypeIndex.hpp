@@ -0,0 +1,65 @@
+// *****************************************************************************
+//
+// This file is part of a MASA library or program.
+// Refer to the included end-user license agreement for restrictions.
+//
+// Copyright (c) 2020 MASA Group
+//
+// *****************************************************************************
+
+#ifndef ECORE_RESOURCETYPEINDEX_HPP_
+#define ECORE_RESOURCETYPEINDEX_HPP_
+
+#include "ecore/EResourceTypeIndex.hpp"
+#include "ecore/Exports.hpp"
+
+#include <unordered_map>
+#include <utility>
+
+namespace ecore::impl
+{
+    class ResourceTypeIndex : public EResourceTypeIndex
+    {
+    public:
+        ResourceTypeIndex() = default;
+
+        virtual ~ResourceTypeIndex() = default;
+
+        virtual void clear();
+
+        virtual void registerObject( const std::shared_ptr<EObject>& eObject );
+
+        virtual void unregisterObject( const std::shared_ptr<EObject>& eObject );
+
+        virtual std::vector<std::shared_ptr<EObject>> getInstances( const std::shared_ptr<EClass>& eClass ) const;
+
+    private:
+        std::size_t getClassID( const std::shared_ptr<EClass>& eClass );
+        const std::vector<std::size_t>& getSubClassIDs( const std::shared_ptr<EClass>& eClass ) const;
+
+    private:
+        struct Instances
+        {
+            std::shared_ptr<EClass> eClass_;
+            std::vector<std::shared_ptr<EObject>> eObjects_;
+        };
+
+        struct SubClasses
+        {
+            std::shared_ptr<EClass> eClass_;
+            std::vector<std::size_t> classIDs_;
+        };
+
+        // instances of each registered class, indexed by class id
+        std::vector<Instances> instances_;
+        std::unordered_map<EClass*, std::size_t> classIDs_;
+        // class id and position in its instances of each registered object
+        std::unordered_map<EObject*, std::pair<std::size_t, std::size_t>> positions_;
+        // ids of the registered sub classes of the queried classes, computed with a generation of the super types
+        mutable std::unordered_map<EClass*, SubClasses> subClassIDs_;
+        mutable std::size_t superTypesGeneration_{ 0 };
+    };
+
+}
+
+#endif
@@ -65,6 +65,39 @@ namespace ecore::impl
 
 #endif
 
+    // converts a null terminated utf16 string in result, reusing its buffer
+    inline void utf16_to_utf8( const char16_t* s, std::string& result )
+    {
+        result.clear();
+        for( ; *s; ++s )
+        {
+            char32_t c = *s;
+            if( c >= 0xD800 && c <= 0xDBFF && s[1] >= 0xDC00 && s[1] <= 0xDFFF )
+                c = 0x10000 + ( ( c - 0xD800 ) << 10 ) + ( *++s - 0xDC00 );
+
+            if( c < 0x80 )
+                result += static_cast<char>( c );
+            else if( c < 0x800 )
+            {
+                result += static_cast<char>( 0xC0 | ( c >> 6 ) );
+                result += static_cast<char>( 0x80 | ( c & 0x3F ) );
+            }
+            else if( c < 0x10000 )
+            {
+                result += static_cast<char>( 0xE0 | ( c >> 12 ) );
+                result += static_cast<char>( 0x80 | ( ( c >> 6 ) & 0x3F ) );
+                result += static_cast<char>( 0x80 | ( c & 0x3F ) );
+            }
+            else
+            {
+                result += static_cast<char>( 0xF0 | ( c >> 18 ) );
+                result += static_cast<char>( 0x80 | ( ( c >> 12 ) & 0x3F ) );
+                result += static_cast<char>( 0x80 | ( ( c >> 6 ) & 0x3F ) );
+                result += static_cast<char>( 0x80 | ( c & 0x3F ) );
+            }
+        }
+    }
+
     inline std::vector<std::string> split( const std::string& s, const std::string& token )
     {
         std::vector<std::string> result;
@@ -1,5 +1,4 @@
 #include "ecore/impl/XMILoad.hpp"
-#include "ecore/impl/StringUtils.hpp"
 #include "ecore/impl/XMIResource.hpp"
 
 using namespace ecore;
@@ -11,24 +10,13 @@ namespace utf8
     static constexpr char* ID_ATTRIB = "xmi:id";
     static constexpr char* VERSION_ATTRIB = "xmi:version";
     static constexpr char* UUID_ATTRIB = "xmi:uuid";
+    static constexpr char* XMI_URI = "http://www.omg.org/XMI";
+    static constexpr char* TYPE = "type";
     static std::unordered_set<std::string> NOT_FEATURES = {TYPE_ATTRIB, VERSION_ATTRIB, UUID_ATTRIB};
 } // namespace utf8
 
-namespace utf16
-{
-    static constexpr char16_t* XMI_URI = u"http://www.omg.org/XMI";
-    static constexpr char16_t* TYPE = u"type";
-    static constexpr char16_t* XMI_TYPE_ATTRIB = u"xmi:type";
-} // namespace utf16
-
-namespace utf16
-{
-    static constexpr char16_t* VERSION_ATTRIB = u"xmi:version";
-
-} // namespace utf16
-
-XMILoad::XMILoad( XMIResource& resource )
-    : XMLLoad( resource )
+XMILoad::XMILoad( XMIResource& resource, const EResource::Options& options )
+    : XMLLoad( resource, options )
     , resource_( resource )
 {
     using namespace utf8;
@@ -41,26 +29,26 @@ XMILoad::~XMILoad()
 
 std::string ecore::impl::XMILoad::getXSIType() const
 {
-    using namespace utf16;
+    using namespace utf8;
     auto xsiType = XMLLoad::getXSIType();
     if( xsiType.empty() )
     {
         auto xmiType = isNamespaceAware_
-                           ? ( attributes_ ? attributes_->getValue( XMI_URI, TYPE ) : attributes_->getValue( XMI_TYPE_ATTRIB ) )
+                           ? ( attributes_ ? attributes_->getValue( XMI_URI, TYPE ) : attributes_->getValue( TYPE_ATTRIB ) )
                            : nullptr;
-        xsiType = xmiType ? utf16_to_utf8( xmiType ) : "";
+        xsiType = xmiType ? *xmiType : "";
     }
     return xsiType;
 }
 
 void XMILoad::handleAttributes( const std::shared_ptr<EObject>& eObject )
 {
-    using namespace utf16;
+    using namespace utf8;
     if( attributes_ )
     {
         auto xmiVersion = attributes_->getValue( VERSION_ATTRIB );
         if( xmiVersion )
-            resource_.setXMIVersion( utf16_to_utf8( xmiVersion ) );
+            resource_.setXMIVersion( *xmiVersion );
     }
     XMLLoad::handleAttributes( eObject );
 }
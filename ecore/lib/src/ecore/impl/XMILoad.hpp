@@ -19,7 +19,7 @@ namespace ecore::impl
     class XMILoad : public XMLLoad
     {
     public:
-        XMILoad( XMIResource& resource );
+        XMILoad( XMIResource& resource, const EResource::Options& options );
 
         virtual ~XMILoad();
     
@@ -35,12 +35,12 @@ void ecore::impl::XMIResource::setXMIVersion( const std::string& version )
     xmiVersion_ = version;
 }
 
-std::unique_ptr<XMLLoad> XMIResource::createXMLLoad()
+std::unique_ptr<XMLLoad> XMIResource::createXMLLoad( const Options& options )
 {
-    return std::move( std::make_unique<XMILoad>( *this ) );
+    return std::move( std::make_unique<XMILoad>( *this, options ) );
 }
 
-std::unique_ptr<XMLSave> XMIResource::createXMLSave()
+std::unique_ptr<XMLSave> XMIResource::createXMLSave( const Options& options )
 {
-    return std::move( std::make_unique<XMISave>( *this ) );
+    return std::move( std::make_unique<XMISave>( *this, options ) );
 }
@@ -30,9 +30,9 @@ namespace ecore::impl
         void setXMIVersion( const std::string& version );
 
     protected:
-        virtual std::unique_ptr<XMLLoad> createXMLLoad() override;
+        virtual std::unique_ptr<XMLLoad> createXMLLoad( const Options& options ) override;
 
-        virtual std::unique_ptr<XMLSave> createXMLSave() override;
+        virtual std::unique_ptr<XMLSave> createXMLSave( const Options& options ) override;
 
     private:
         std::string xmiVersion_;
@@ -11,8 +11,8 @@ namespace utf8
     const char* XMI_URI = "http://www.omg.org/XMI";
 }
 
-XMISave::XMISave( XMIResource& resource )
-    : XMLSave( resource )
+XMISave::XMISave( XMIResource& resource, const EResource::Options& options )
+    : XMLSave( resource, options )
     , resource_( resource )
 {
 }
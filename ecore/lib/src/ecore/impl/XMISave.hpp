@@ -19,7 +19,7 @@ namespace ecore::impl
     class XMISave : public XMLSave
     {
     public:
-        XMISave( XMIResource& resource );
+        XMISave( XMIResource& resource, const EResource::Options& options );
 
         virtual ~XMISave();
 
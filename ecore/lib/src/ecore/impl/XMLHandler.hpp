@@ -0,0 +1,152 @@
+// *****************************************************************************
+//
+// This file is part of a MASA library or program.
+// Refer to the included end-user license agreement for restrictions.
+//
+// Copyright (c) 2020 MASA Group
+//
+// *****************************************************************************
+
+#ifndef ECORE_XMLHANDLER_HPP_
+#define ECORE_XMLHANDLER_HPP_
+
+#include <istream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ecore
+{
+    class EResourceStatistics;
+}
+
+namespace ecore::impl
+{
+    // The attributes of an element in utf-8 : their strings are reused from an element to the other.
+    class XMLAttributes
+    {
+    public:
+        struct Attribute
+        {
+            std::string qName_;
+            std::string uri_;
+            std::string localName_;
+            std::string value_;
+        };
+
+        std::size_t getLength() const
+        {
+            return size_;
+        }
+
+        const std::string& getQName( std::size_t index ) const
+        {
+            return attributes_[index].qName_;
+        }
+
+        const std::string& getURI( std::size_t index ) const
+        {
+            return attributes_[index].uri_;
+        }
+
+        const std::string& getLocalName( std::size_t index ) const
+        {
+            return attributes_[index].localName_;
+        }
+
+        const std::string& getValue( std::size_t index ) const
+        {
+            return attributes_[index].value_;
+        }
+
+        // returns nullptr if the element has no such attribute
+        const std::string* getValue( std::string_view uri, std::string_view localName ) const
+        {
+            for( std::size_t i = 0; i < size_; ++i )
+            {
+                const auto& attribute = attributes_[i];
+                if( attribute.localName_ == localName && attribute.uri_ == uri )
+                    return &attribute.value_;
+            }
+            return nullptr;
+        }
+
+        const std::string* getValue( std::string_view qName ) const
+        {
+            for( std::size_t i = 0; i < size_; ++i )
+            {
+                const auto& attribute = attributes_[i];
+                if( attribute.qName_ == qName )
+                    return &attribute.value_;
+            }
+            return nullptr;
+        }
+
+        void clear()
+        {
+            size_ = 0;
+        }
+
+        Attribute& add()
+        {
+            if( size_ == attributes_.size() )
+                attributes_.emplace_back();
+            return attributes_[size_++];
+        }
+
+    private:
+        std::vector<Attribute> attributes_;
+        std::size_t size_{0};
+    };
+
+    class XMLLocator
+    {
+    public:
+        virtual ~XMLLocator() = default;
+
+        virtual std::string getSystemId() const = 0;
+
+        virtual int getLineNumber() const = 0;
+
+        virtual int getColumnNumber() const = 0;
+    };
+
+    // SAX like events of a parsed document, names and values are in utf-8
+    class XMLHandler
+    {
+    public:
+        virtual ~XMLHandler() = default;
+
+        virtual void setDocumentLocator( const XMLLocator* locator ) = 0;
+
+        virtual void startDocument() = 0;
+
+        virtual void endDocument() = 0;
+
+        // called for each namespace declared by an element before its startElement
+        virtual void startPrefixMapping( const std::string& prefix, const std::string& uri ) = 0;
+
+        virtual void startElement( const std::string& uri,
+                                   const std::string& localName,
+                                   const std::string& qName,
+                                   const XMLAttributes& attributes )
+            = 0;
+
+        virtual void endElement( const std::string& uri, const std::string& localName, const std::string& qName ) = 0;
+
+        virtual void error( const std::string& message, int line, int column ) = 0;
+
+        virtual void warning( const std::string& message, int line, int column ) = 0;
+    };
+
+    class XMLParser
+    {
+    public:
+        virtual ~XMLParser() = default;
+
+        virtual void parse( std::istream& is, XMLHandler& handler, EResourceStatistics* statistics ) = 0;
+    };
+
+} // namespace ecore::impl
+
+#endif
@@ -10,6 +10,8 @@
 #ifndef ECORE_XMLINPUTSOURCE_HPP_
 #define ECORE_XMLINPUTSOURCE_HPP_
 
+#include "ecore/EResourceStatistics.hpp"
+
 #include <xercesc/sax/InputSource.hpp>
 #include <xercesc/util/BinInputStream.hpp>
 #include <istream>
@@ -19,8 +21,9 @@ namespace ecore::impl
     class XMLInputStream : public xercesc::BinInputStream
     {
     public:
-        XMLInputStream( std::istream& is )
+        XMLInputStream( std::istream& is, EResourceStatistics* statistics = nullptr )
             : is_( is )
+            , statistics_( statistics )
         {
         }
 
@@ -57,7 +60,10 @@ namespace ecore::impl
             // Make sure that if we failed, readBytes won't be called
             // again.
             //
-            return !is_.fail() ? static_cast<XMLSize_t>( is_.gcount() ) : 0;
+            auto count = !is_.fail() ? static_cast<XMLSize_t>( is_.gcount() ) : 0;
+            if( statistics_ )
+                statistics_->bytesRead( count );
+            return count;
         }
 
         virtual const XMLCh* getContentType() const
@@ -67,6 +73,7 @@ namespace ecore::impl
 
     private:
         std::istream& is_;
+        EResourceStatistics* statistics_;
     };
 
     class XMLInputSource : public xercesc::InputSource
@@ -121,11 +128,17 @@ namespace ecore::impl
 
             is_ = 0;
 
-            return new XMLInputStream( is );
+            return new XMLInputStream( is, statistics_ );
+        }
+
+        void setStatistics( EResourceStatistics* statistics )
+        {
+            statistics_ = statistics;
         }
 
     private:
         mutable std::istream* is_;
+        EResourceStatistics* statistics_{ nullptr };
     };
 
 } // namespace ecore::impl
@@ -2,6 +2,8 @@
 #include "ecore/Any.hpp"
 #include "ecore/AnyCast.hpp"
 #include "ecore/EClass.hpp"
+#include "ecore/ECollectionView.hpp"
+#include "ecore/EContentAdapter.hpp"
 #include "ecore/EDataType.hpp"
 #include "ecore/EFactory.hpp"
 #include "ecore/EPackage.hpp"
@@ -10,17 +12,24 @@
 #include "ecore/EResource.hpp"
 #include "ecore/EResourceSet.hpp"
 #include "ecore/EStructuralFeature.hpp"
+#include "ecore/EcoreUtils.hpp"
 #include "ecore/impl/Diagnostic.hpp"
 #include "ecore/impl/EObjectInternal.hpp"
+#include "ecore/impl/ImmutableArrayEList.hpp"
+#include "ecore/impl/PrimitiveConverter.hpp"
+#include "ecore/impl/ResourceStatistics.hpp"
 #include "ecore/impl/StringUtils.hpp"
 #include "ecore/impl/XMLResource.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
 #include <string>
+#include <string_view>
+#include <vector>
 
 using namespace ecore;
 using namespace ecore::impl;
-using namespace xercesc;
 
 namespace utf8
 {
@@ -36,20 +45,60 @@ namespace utf8
     static constexpr char* NIL_ATTRIB = "xsi:nil";
     static constexpr char* SCHEMA_LOCATION_ATTRIB = "xsi:schemaLocation";
     static constexpr char* NO_NAMESPACE_SCHEMA_LOCATION_ATTRIB = "xsi:noNamespaceSchemaLocation";
+    static constexpr char* SCHEMA_LOCATION = "schemaLocation";
+    static constexpr char* DELTA_URI = "http://www.masagroup.net/ecore/delta";
+    static constexpr char* DELTA_FRAGMENT = "fragment";
+    static constexpr char* DELTA_FRAGMENT_ATTRIB = "delta:fragment";
+    static constexpr char* DELTA_CONTENTS = "contents";
+    static constexpr char* DELTA_CONTENTS_ATTRIB = "delta:contents";
     static std::unordered_set<std::string> NOT_FEATURES = {TYPE_ATTRIB, SCHEMA_LOCATION_ATTRIB, NO_NAMESPACE_SCHEMA_LOCATION_ATTRIB};
+    static std::unordered_set<std::string> DELTA_NOT_FEATURES = {DELTA_FRAGMENT_ATTRIB, DELTA_CONTENTS_ATTRIB};
 } // namespace utf8
 
-namespace utf16
+namespace
 {
-    static constexpr char16_t* XSI_URI = u"http://www.w3.org/2001/XMLSchema-instance";
-    static constexpr char16_t* SCHEMA_LOCATION = u"schemaLocation";
-    static constexpr char16_t* TYPE = u"type";
-    static constexpr char16_t* TYPE_ATTRIB = u"xsi:type";
-    static constexpr char16_t* NO_NAMESPACE_SCHEMA_LOCATION = u"noNamespaceSchemaLocation";
-} // namespace utf16
+    // the objects of a list that are not at their final index yet, by initial index :
+    // they follow the objects already ordered, in their initial order
+    class PendingIndexes
+    {
+    public:
+        PendingIndexes( std::size_t size )
+            : tree_( size + 1, 0 )
+        {
+            for( std::size_t i = 1; i <= size; ++i )
+            {
+                tree_[i] += 1;
+                auto parent = i + ( i & ( ~i + 1 ) );
+                if( parent <= size )
+                    tree_[parent] += tree_[i];
+            }
+        }
 
-XMLLoad::XMLLoad( XMLResource& resource )
+        // number of pending objects whose initial index is lower than index
+        std::size_t countBefore( std::size_t index ) const
+        {
+            std::size_t count = 0;
+            for( auto i = index; i > 0; i -= i & ( ~i + 1 ) )
+                count += tree_[i];
+            return count;
+        }
+
+        void remove( std::size_t index )
+        {
+            for( auto i = index + 1; i < tree_.size(); i += i & ( ~i + 1 ) )
+                --tree_[i];
+        }
+
+    private:
+        std::vector<std::size_t> tree_;
+    };
+} // namespace
+
+XMLLoad::XMLLoad( XMLResource& resource, const EResource::Options& options )
     : resource_( resource )
+    , statistics_( resource.getStatistics().get() )
+    , isResolveDeferred_( XMLResource::getOption( options, XMLResource::OPTION_DEFER_IDREF_RESOLUTION, false ) )
+    , isDisableNotify_( XMLResource::getOption( options, XMLResource::OPTION_DISABLE_NOTIFY, false ) )
     , packageRegistry_( resource_.getResourceSet() ? resource_.getResourceSet()->getPackageRegistry() : EPackageRegistry::getInstance() )
 {
     using namespace utf8;
@@ -58,9 +107,19 @@ XMLLoad::XMLLoad( XMLResource& resource )
 
 XMLLoad::~XMLLoad()
 {
+    // a document which is not well formed ends without endDocument
+    enableNotifications();
 }
 
-void XMLLoad::setDocumentLocator( const Locator* const locator )
+void XMLLoad::setDelta( bool isDelta )
+{
+    using namespace utf8;
+    isDelta_ = isDelta;
+    if( isDelta_ )
+        notFeatures_.insert( DELTA_NOT_FEATURES.begin(), DELTA_NOT_FEATURES.end() );
+}
+
+void XMLLoad::setDocumentLocator( const XMLLocator* locator )
 {
     locator_ = locator;
 }
@@ -74,20 +133,21 @@ void XMLLoad::startDocument()
 
 void XMLLoad::endDocument()
 {
-    auto _ = namespaces_.popContext();
+    namespaces_.popContext();
     handleReferences();
+    enableNotifications();
 }
 
-void XMLLoad::startElement( const XMLCh* const uri,
-                            const XMLCh* const localname,
-                            const XMLCh* const qname,
-                            const xercesc::Attributes& attrs )
+void XMLLoad::startElement( const std::string& uri,
+                            const std::string& localName,
+                            const std::string& qName,
+                            const XMLAttributes& attributes )
 {
-    setAttributes( &attrs );
-    startElement( utf16_to_utf8( uri ), utf16_to_utf8( localname ), utf16_to_utf8( qname ) );
+    setAttributes( &attributes );
+    startElement( uri, localName, qName );
 }
 
-void XMLLoad::startElement( const std::string uri, const std::string& localName, const std::string& qname )
+void XMLLoad::startElement( const std::string& uri, const std::string& localName, const std::string& qname )
 {
     // create a new context in the namespaces
     if( isPushContext_ )
@@ -98,24 +158,23 @@ void XMLLoad::startElement( const std::string uri, const std::string& localName,
     // if startPrefixMapping is not called
     handleNamespaces();
 
-    //
-    elements_.push( qname );
+    if( statistics_ )
+        statistics_->elementParsed();
 
     // process element
     processElement( qname, namespaces_.getPrefix( uri ), localName );
 }
 
-void XMLLoad::endElement( const XMLCh* const uri, const XMLCh* const localname, const XMLCh* const qname )
+void XMLLoad::endElement( const std::string& uri, const std::string& localName, const std::string& qName )
 {
     objects_.pop();
 
     // pop namespace context and remove corresponding namespace factories
-    auto prefixes = namespaces_.popContext();
-    for( auto p : prefixes )
-        auto _ = prefixesToFactories_.extract( p.first );
+    for( const auto& p : namespaces_.popContext() )
+        prefixesToFactories_.erase( p.first );
 }
 
-void XMLLoad::startPrefixMapping( const XMLCh* const prefix, const XMLCh* const uri )
+void XMLLoad::startPrefixMapping( const std::string& prefix, const std::string& uri )
 {
     isNamespaceAware_ = true;
     if( isPushContext_ )
@@ -123,40 +182,26 @@ void XMLLoad::startPrefixMapping( const XMLCh* const prefix, const XMLCh* const
         namespaces_.pushContext();
         isPushContext_ = false;
     }
-    handleNamespace( utf16_to_utf8( prefix ), utf16_to_utf8( uri ) );
-}
-
-void XMLLoad::endPrefixMapping( const XMLCh* const prefix )
-{
+    handleNamespace( prefix, uri );
 }
 
-void XMLLoad::characters( const XMLCh* const chars, const XMLSize_t length )
+void XMLLoad::error( const std::string& message, int line, int column )
 {
+    error( std::make_shared<Diagnostic>( message, "", line, column ) );
 }
 
-void XMLLoad::error( const SAXParseException& exc )
+void XMLLoad::warning( const std::string& message, int line, int column )
 {
-    error( std::make_shared<Diagnostic>(
-        utf16_to_utf8( exc.getMessage() ), "", static_cast<int>( exc.getLineNumber() ), static_cast<int>( exc.getColumnNumber() ) ) );
-}
-
-void XMLLoad::fatalError( const SAXParseException& exc )
-{
-    error( std::make_shared<Diagnostic>(
-        utf16_to_utf8( exc.getMessage() ), "", static_cast<int>( exc.getLineNumber() ), static_cast<int>( exc.getColumnNumber() ) ) );
-}
-
-void XMLLoad::warning( const SAXParseException& exc )
-{
-    warning( std::make_shared<Diagnostic>(
-        utf16_to_utf8( exc.getMessage() ), "", static_cast<int>( exc.getLineNumber() ), static_cast<int>( exc.getColumnNumber() ) ) );
+    warning( std::make_shared<Diagnostic>( message, "", line, column ) );
 }
 
 void XMLLoad::processElement( const std::string& name, const std::string& prefix, const std::string& localName )
 {
     isRoot_ = false;
 
-    if( objects_.empty() )
+    if( isDelta_ && objects_.size() < 2 )
+        processDeltaElement( prefix, localName );
+    else if( objects_.empty() )
     {
         auto eObject = createObject( prefix, localName );
         if( eObject )
@@ -169,6 +214,69 @@ void XMLLoad::processElement( const std::string& name, const std::string& prefix
         handleFeature( prefix, localName );
 }
 
+void XMLLoad::processDeltaElement( const std::string& prefix, const std::string& localName )
+{
+    using namespace utf8;
+    if( objects_.empty() )
+    {
+        // delta element : its top objects replace the contents when they are all written
+        if( getDeltaAttribute( DELTA_CONTENTS, DELTA_CONTENTS_ATTRIB ) == "true" )
+            resource_.getContents()->clear();
+        objects_.push( nullptr );
+        return;
+    }
+
+    std::shared_ptr<EObject> eObject;
+    auto fragment = getDeltaAttribute( DELTA_FRAGMENT, DELTA_FRAGMENT_ATTRIB );
+    if( fragment.empty() )
+    {
+        eObject = createObject( prefix, localName );
+        if( eObject )
+            resource_.getContents()->add( eObject );
+    }
+    else
+    {
+        // modified object : its written features replace its current ones
+        eObject = resource_.getEObject( fragment );
+        if( eObject )
+        {
+            resetFeatures( eObject, getDeltaAttribute( DELTA_CONTENTS, DELTA_CONTENTS_ATTRIB ) == "true" );
+            handleAttributes( eObject );
+        }
+        else
+            error( std::make_shared<Diagnostic>( "Object '" + fragment + "' not found", getLocation(), getLineNumber(), getColumnNumber() ) );
+    }
+    objects_.push( eObject );
+}
+
+void XMLLoad::resetFeatures( const std::shared_ptr<EObject>& eObject, bool isContentsModified )
+{
+    for( const auto& eFeature : *eObject->eClass()->getEAllStructuralFeatures() )
+    {
+        if( eFeature->isTransient() || !eFeature->isChangeable() )
+            continue;
+
+        if( auto eReference = std::dynamic_pointer_cast<EReference>( eFeature ) )
+        {
+            if( eReference->isContainer() || ( eReference->isContainment() && !isContentsModified ) )
+                continue;
+
+            // as in a load, a single reference with a many opposite is set from the opposite side
+            auto eOpposite = eReference->getEOpposite();
+            if( !eReference->isMany() && eOpposite && !eOpposite->isTransient() && eOpposite->isMany() )
+                continue;
+        }
+        eObject->eUnset( eFeature );
+    }
+}
+
+std::string XMLLoad::getDeltaAttribute( const char* localName, const char* qName ) const
+{
+    using namespace utf8;
+    auto value = attributes_ ? ( isNamespaceAware_ ? attributes_->getValue( DELTA_URI, localName ) : attributes_->getValue( qName ) ) : nullptr;
+    return value ? *value : "";
+}
+
 std::shared_ptr<EObject> ecore::impl::XMLLoad::createObject( const std::shared_ptr<EObject> eObject,
                                                              const std::shared_ptr<EStructuralFeature>& eFeature )
 {
@@ -201,7 +309,18 @@ std::shared_ptr<EObject> XMLLoad::createObject( const std::shared_ptr<EFactory>&
         {
             auto eObject = eFactory->create( eClass );
             if( eObject )
+            {
+                if( statistics_ )
+                    statistics_->objectCreated( eClass );
+
+                // objects of a delta are added to contents which may be observed
+                if( isDisableNotify_ && !isDelta_ )
+                {
+                    eObject->eSetDeliver( false );
+                    undeliveredObjects_.push_back( eObject );
+                }
                 handleAttributes( eObject );
+            }
             return eObject;
         }
     }
@@ -292,11 +411,23 @@ void XMLLoad::setFeatureValue( const std::shared_ptr<EObject>& eObject,
     {
         auto eClassifier = eFeature->getEType();
         auto eDataType = std::dynamic_pointer_cast<EDataType>( eClassifier );
-        auto eFactory = eDataType->getEPackage()->getEFactoryInstance();
         if( value.empty() )
             eObject->eSet( eFeature, Any() );
         else
-            eObject->eSet( eFeature, eFactory->createFromString( eDataType, anyCast<std::string>( value ) ) );
+        {
+            // primitive types are converted without their factory
+            const auto& literal = anyCast<const std::string&>( value );
+            Any converted;
+            if( !PrimitiveConverter::createFromString( PrimitiveConverter::getKind( eDataType ), literal, converted ) )
+                converted = eDataType->getEPackage()->getEFactoryInstance()->createFromString( eDataType, literal );
+            eObject->eSet( eFeature, converted );
+            if( statistics_ )
+                statistics_->attributeConverted();
+
+            // ids loaded once the table is built are added to it
+            if( isObjectsByIDBuilt_ && eFeature == eObject->eClass()->getEIDAttribute() )
+                objectsByID_.emplace( EcoreUtils::getID( eObject ), eObject );
+        }
         break;
     }
     case Many:
@@ -314,6 +445,8 @@ void XMLLoad::setFeatureValue( const std::shared_ptr<EObject>& eObject,
                 auto any = eFactory->createFromString( eDataType, t );
                 auto eValue = anyObjectCast<std::shared_ptr<EObject>>( any );
                 eList->add( eValue );
+                if( statistics_ )
+                    statistics_->attributeConverted();
             }
         }
         else if( value.empty() )
@@ -324,6 +457,8 @@ void XMLLoad::setFeatureValue( const std::shared_ptr<EObject>& eObject,
             auto any = eFactory->createFromString( eDataType, s );
             auto eValue = anyObjectCast<std::shared_ptr<EObject>>( any );
             eList->add( eValue );
+            if( statistics_ )
+                statistics_->attributeConverted();
         }
     }
     case ManyAdd:
@@ -381,12 +516,19 @@ void XMLLoad::setAttributeValue( const std::shared_ptr<EObject>& eObject, const
         handleUnknownFeature( localName );
 }
 
+struct XMLLoad::ReferenceID
+{
+    std::size_t offset_;
+    std::size_t size_;
+    int pos_;
+};
+
 struct XMLLoad::Reference
 {
     std::shared_ptr<EObject> object_;
     std::shared_ptr<EStructuralFeature> feature_;
-    std::string id_;
-    int pos_;
+    std::string ids_;
+    std::vector<ReferenceID> deferred_;
     int line_;
     int column_;
 };
@@ -398,29 +540,35 @@ void XMLLoad::setValueFromId( const std::shared_ptr<EObject>& eObject,
     bool mustAdd = isResolveDeferred_;
     bool mustAddOrNotOppositeIsMany = false;
     bool isFirstID = true;
+    bool isDeferred = false;
     int position = 0;
-    int line = getLineNumber();
-    int column = getColumnNumber();
-    std::vector<Reference> references;
     std::string qName;
-    auto tokens = split( ids, " " );
-    for( auto token : tokens )
+    std::size_t start = 0;
+    for( std::size_t end = 0; end != std::string::npos; start = end + 1 )
     {
-        std::string id( token );
-        std::size_t index = id.find( '#' );
+        // ids are read in place and copied in a reused buffer
+        end = ids.find( ' ', start );
+        auto offset = start;
+        auto size = ( end == std::string::npos ? ids.size() : end ) - start;
+        auto token = std::string_view( ids ).substr( offset, size );
+        std::size_t index = token.find( '#' );
         if( index != std::string::npos )
         {
             if( index == 0 )
-                id = token.substr( 1 );
+            {
+                ++offset;
+                --size;
+            }
             else
             {
+                id_.assign( ids, offset, size );
                 auto oldAttributes = setAttributes( nullptr );
                 std::shared_ptr<EObject> eProxy = qName.empty() ? createObjectFromFeatureType( eObject, eReference )
                                                                 : createObjectFromTypeName( eObject, qName, eReference );
                 setAttributes( oldAttributes );
                 if( eProxy )
                 {
-                    handleProxy( eProxy, id );
+                    handleProxy( eProxy, id_ );
                     setFeatureValue( eObject, eReference, eProxy );
                 }
 
@@ -430,9 +578,9 @@ void XMLLoad::setValueFromId( const std::shared_ptr<EObject>& eObject,
                 continue;
             }
         }
-        else if( id.find( ':' ) != std::string::npos )
+        else if( token.find( ':' ) != std::string::npos )
         {
-            qName = id;
+            qName = token;
             continue;
         }
 
@@ -454,12 +602,16 @@ void XMLLoad::setValueFromId( const std::shared_ptr<EObject>& eObject,
                 isFirstID = false;
             }
 
-            if( mustAddOrNotOppositeIsMany )
+            // objects of a delta are resolved once all of them are created
+            if( mustAddOrNotOppositeIsMany && !isDelta_ )
             {
-                auto resolved = resource_.getEObject( id );
+                id_.assign( ids, offset, size );
+                auto resolved = getEObject( id_ );
                 if( resolved )
                 {
                     setFeatureValue( eObject, eReference, resolved );
+                    if( statistics_ )
+                        statistics_->referenceResolved();
                     qName.clear();
                     ++position;
                     continue;
@@ -467,8 +619,18 @@ void XMLLoad::setValueFromId( const std::shared_ptr<EObject>& eObject,
             }
         }
 
-        if( mustAdd )
-            references.push_back( {eObject, eReference, id, position, line, column} );
+        if( mustAdd || ( isDelta_ && mustAddOrNotOppositeIsMany ) )
+        {
+            // the ids of an attribute are deferred together
+            if( !isDeferred )
+            {
+                references_.push_back( {eObject, eReference, ids, {}, getLineNumber(), getColumnNumber()} );
+                isDeferred = true;
+            }
+            references_.back().deferred_.push_back( {offset, size, position} );
+            if( statistics_ )
+                statistics_->referenceDeferred();
+        }
 
         qName.clear();
         ++position;
@@ -476,23 +638,22 @@ void XMLLoad::setValueFromId( const std::shared_ptr<EObject>& eObject,
 
     if( position == 0 )
         setFeatureValue( eObject, eReference, Any(), -2 );
-    else
-        references_.insert( references_.end(), references.begin(), references.end() );
 }
 
 std::string XMLLoad::getLocation() const
 {
-    return locator_ && locator_->getSystemId() ? utf16_to_utf8( locator_->getSystemId() ) : resource_.getURI().toString();
+    auto systemId = locator_ ? locator_->getSystemId() : std::string();
+    return !systemId.empty() ? systemId : resource_.getURI().toString();
 }
 
 int XMLLoad::getLineNumber() const
 {
-    return locator_ ? static_cast<int>( locator_->getLineNumber() ) : -1;
+    return locator_ ? locator_->getLineNumber() : -1;
 }
 
 int XMLLoad::getColumnNumber() const
 {
-    return locator_ ? static_cast<int>( locator_->getColumnNumber() ) : -1;
+    return locator_ ? locator_->getColumnNumber() : -1;
 }
 
 void XMLLoad::handleFeature( const std::string& prefix, const std::string& name )
@@ -527,6 +688,7 @@ void XMLLoad::handleUnknownPackage( const std::string& name )
 
 void XMLLoad::handleReferences()
 {
+    PhaseTimer timer( statistics_, EResourceStatistics::Phase::HANDLE_REFERENCES );
     for( auto eProxy : sameDocumentProxies_ )
     {
         for( auto eReference : eProxy->eClass()->getEAllReferences() )
@@ -534,7 +696,7 @@ void XMLLoad::handleReferences()
             auto eOpposite = eReference->getEOpposite();
             if( eOpposite && eOpposite->isChangeable() && eProxy->eIsSet( eReference ) )
             {
-                auto resolvedObject = resource_.getEObject( eProxy->getInternal().eProxyURI().getFragment() );
+                auto resolvedObject = getEObject( eProxy->getInternal().eProxyURI().getFragment() );
                 if( resolvedObject )
                 {
                     std::shared_ptr<EObject> proxyHolder;
@@ -597,20 +759,187 @@ void XMLLoad::handleReferences()
         }
     }
 
-    for( auto& reference : references_ )
+    for( const auto& reference : references_ )
     {
-        auto eObject = resource_.getEObject( reference.id_ );
-        if( eObject )
-            setFeatureValue( reference.object_, reference.feature_, eObject, reference.pos_ );
+        auto kind = getFeatureKind( reference.feature_ );
+        if( kind == ManyAdd || kind == ManyMove )
+            handleManyReference( reference, kind );
         else
-            error( std::make_shared<Diagnostic>(
-                "Unresolved reference '" + reference.id_ + "'", getLocation(), reference.line_, reference.column_ ) );
+        {
+            for( const auto& id : reference.deferred_ )
+            {
+                auto eObject = getEObject( reference, id );
+                if( eObject )
+                    setFeatureValue( reference.object_, reference.feature_, eObject, id.pos_ );
+            }
+        }
+    }
+}
+
+void XMLLoad::enableNotifications()
+{
+    auto getNotifier = []( const std::shared_ptr<EObject>& eObject ) -> std::shared_ptr<ENotifier> {
+        auto& eInternal = eObject->getInternal();
+        if( auto eContainer = eInternal.eInternalContainer() )
+            return eContainer;
+        return eInternal.eInternalResource();
+    };
+
+    // roots added to a notifying resource were adapted before their contents and references were loaded :
+    // their content adapters are removed to be set again on the loaded objects
+    for( const auto& eObject : undeliveredObjects_ )
+    {
+        auto eNotifier = getNotifier( eObject );
+        if( !eNotifier )
+            continue;
+
+        auto& eAdapters = eObject->eAdapters();
+        for( auto eAdapter : eNotifier->eAdapters() )
+        {
+            if( dynamic_cast<EContentAdapter*>( eAdapter ) && eAdapters.contains( eAdapter ) )
+                eAdapters.remove( eAdapter );
+        }
+    }
+
+    for( const auto& eObject : undeliveredObjects_ )
+        eObject->eSetDeliver( true );
+
+    // contents added without notification didn't receive the content adapters of their container :
+    // objects are created before their contents, so containers are adapted first
+    for( const auto& eObject : undeliveredObjects_ )
+    {
+        auto eNotifier = getNotifier( eObject );
+        if( !eNotifier )
+            continue;
+
+        auto& eAdapters = eObject->eAdapters();
+        for( auto eAdapter : eNotifier->eAdapters() )
+        {
+            if( dynamic_cast<EContentAdapter*>( eAdapter ) && !eAdapters.contains( eAdapter ) )
+                eAdapters.add( eAdapter );
+        }
+    }
+    undeliveredObjects_.clear();
+}
+
+void XMLLoad::handleManyReference( const Reference& reference, FeatureKind kind )
+{
+    auto eList = anyListCast<std::shared_ptr<EObject>>( reference.object_->eGet( reference.feature_, false ) );
+
+    // objects already in the list by initial index : added by their opposite or by the ids resolved while parsing.
+    // Objects added or ordered here are not pending anymore
+    constexpr auto notPending = std::numeric_limits<std::size_t>::max();
+    std::unordered_map<std::shared_ptr<EObject>, std::size_t> contents;
+    contents.reserve( eList->size() + reference.deferred_.size() );
+    std::size_t index = 0;
+    for( const auto& eObject : *eList )
+        contents.emplace( eObject, index++ );
+
+    // objects moved in a list are ordered from its start : their index is computed instead of looked up
+    auto isMove = kind == ManyMove;
+    PendingIndexes pending( isMove ? eList->size() : 0 );
+    std::size_t ordered = 0;
+
+    // consecutive new objects are added at their position at once, they are known not to be in the list
+    std::vector<std::shared_ptr<EObject>> added;
+    std::size_t addedPosition = 0;
+    auto addAll = [&]() {
+        if( !added.empty() )
+        {
+            eList->addAllUnique( std::min( addedPosition, eList->size() ), ImmutableArrayEList<std::shared_ptr<EObject>>( added ) );
+            added.clear();
+        }
+    };
+
+    int nbUnresolved = 0;
+    for( const auto& id : reference.deferred_ )
+    {
+        auto eObject = getEObject( reference, id );
+        if( !eObject )
+        {
+            ++nbUnresolved;
+            continue;
+        }
+
+        auto position = static_cast<std::size_t>( id.pos_ - nbUnresolved );
+        auto it = contents.find( eObject );
+        if( it != contents.end() )
+        {
+            if( isMove )
+            {
+                if( it->second != notPending )
+                {
+                    addAll();
+                    auto oldPosition = ordered + pending.countBefore( it->second );
+                    if( oldPosition != ordered )
+                        eList->move( ordered, oldPosition );
+                    pending.remove( it->second );
+                    it->second = notPending;
+                    ++ordered;
+                }
+            }
+            else if( eObject == reference.object_ )
+            {
+                // a reference to the object itself is the only one moved in a list that is not ordered
+                addAll();
+                position = std::min( position, eList->size() - 1 );
+                auto oldPosition = eList->indexOf( eObject );
+                if( oldPosition != position )
+                    eList->move( position, oldPosition );
+            }
+            continue;
+        }
+
+        if( isMove )
+            position = ordered++;
+        if( !added.empty() && position != addedPosition + added.size() )
+            addAll();
+        if( added.empty() )
+            addedPosition = position;
+        added.push_back( eObject );
+        contents.emplace( eObject, notPending );
     }
+    addAll();
 }
 
-const Attributes* XMLLoad::setAttributes( const xercesc::Attributes* attrs )
+std::shared_ptr<EObject> XMLLoad::getEObject( const Reference& reference, const ReferenceID& id )
 {
-    const Attributes* oldAttributes = attributes_;
+    id_.assign( reference.ids_, id.offset_, id.size_ );
+    auto eObject = getEObject( id_ );
+    if( eObject )
+    {
+        if( statistics_ )
+            statistics_->referenceResolved();
+    }
+    else
+        error( std::make_shared<Diagnostic>( "Unresolved reference '" + id_ + "'", getLocation(), reference.line_, reference.column_ ) );
+    return eObject;
+}
+
+std::shared_ptr<EObject> XMLLoad::getEObject( const std::string& uriFragment )
+{
+    // without an id manager, ids are looked up in a table built once instead of a scan of the contents per id
+    if( uriFragment.empty() || uriFragment.front() == '/' || uriFragment.back() == '?' || resource_.getIDManager() )
+        return resource_.getEObject( uriFragment );
+
+    if( !isObjectsByIDBuilt_ )
+    {
+        auto allContents = std::make_shared<ECollectionView<std::shared_ptr<EObject>>>( resource_.getContents(), false );
+        for( const auto& eObject : *allContents )
+        {
+            auto id = EcoreUtils::getID( eObject );
+            if( !id.empty() )
+                objectsByID_.emplace( std::move( id ), eObject );
+        }
+        isObjectsByIDBuilt_ = true;
+    }
+    auto it = objectsByID_.find( uriFragment );
+    return it != objectsByID_.end() ? it->second : nullptr;
+}
+
+const XMLAttributes* XMLLoad::setAttributes( const XMLAttributes* attrs )
+{
+    const XMLAttributes* oldAttributes = attributes_;
     attributes_ = attrs;
     return oldAttributes;
 }
@@ -619,6 +948,8 @@ void XMLLoad::handleProxy( const std::shared_ptr<EObject>& eProxy, const std::st
 {
     auto uri = URI( id );
     eProxy->getInternal().eSetProxyURI( uri );
+    if( statistics_ )
+        statistics_->proxyCreated();
     if( uri.trimFragment() == resource_.getURI() )
         sameDocumentProxies_.push_back( eProxy );
 }
@@ -628,18 +959,17 @@ void XMLLoad::handleAttributes( const std::shared_ptr<EObject>& eObject )
     using namespace utf8;
     if( attributes_ )
     {
-        for( int i = 0; i < attributes_->getLength(); ++i )
+        for( std::size_t i = 0; i < attributes_->getLength(); ++i )
         {
-            auto name = utf16_to_utf8( attributes_->getQName( i ) );
-            auto value = utf16_to_utf8( attributes_->getValue( i ) );
+            const auto& name = attributes_->getQName( i );
+            const auto& value = attributes_->getValue( i );
             if( name == HREF )
                 handleProxy( eObject, value );
             else if( notFeatures_.find( name ) == notFeatures_.end() )
             {
                 if( isNamespaceAware_ )
                 {
-                    auto uri = utf16_to_utf8( attributes_->getURI( i ) );
-                    if( uri != XSI_URI )
+                    if( attributes_->getURI( i ) != XSI_URI )
                         setAttributeValue( eObject, name, value );
                 }
                 else if( !startsWith( name, XML_NS ) )
@@ -651,22 +981,22 @@ void XMLLoad::handleAttributes( const std::shared_ptr<EObject>& eObject )
 
 std::string XMLLoad::getXSIType() const
 {
-    using namespace utf16;
+    using namespace utf8;
     auto xsiType
         = isNamespaceAware_ ? ( attributes_ ? attributes_->getValue( XSI_URI, TYPE ) : attributes_->getValue( TYPE_ATTRIB ) ) : nullptr;
-    return xsiType ? utf16_to_utf8( xsiType ) : "";
+    return xsiType ? *xsiType : "";
 }
 
 void XMLLoad::handleNamespaces()
 {
     using namespace utf8;
+    PhaseTimer timer( statistics_, EResourceStatistics::Phase::NAMESPACES );
     if( attributes_ )
     {
-        for( int i = 0; i < attributes_->getLength(); ++i )
+        for( std::size_t i = 0; i < attributes_->getLength(); ++i )
         {
-
-            auto name = utf16_to_utf8( attributes_->getQName( i ) );
-            auto value = utf16_to_utf8( attributes_->getValue( i ) );
+            const auto& name = attributes_->getQName( i );
+            const auto& value = attributes_->getValue( i );
             if( name.find( XML_NS ) != -1 )
                 handleNamespace( name.substr( 6 ), value );
             else if( name == SCHEMA_LOCATION_ATTRIB )
@@ -685,16 +1015,16 @@ void XMLLoad::handleNamespace( const std::string prefix, const std::string& uri
 
 void XMLLoad::handleSchemaLocation()
 {
-    using namespace utf16;
+    using namespace utf8;
     if( attributes_ )
     {
         auto xsiSchemaLocation = attributes_->getValue( XSI_URI, SCHEMA_LOCATION );
         if( xsiSchemaLocation )
-            handleXSISchemaLocation( utf16_to_utf8( xsiSchemaLocation ) );
+            handleXSISchemaLocation( *xsiSchemaLocation );
 
         auto xsiNoNamespaceSchemaLocation = attributes_->getValue( XSI_URI, NO_NAMESPACE_SCHEMA_LOCATION );
         if( xsiNoNamespaceSchemaLocation )
-            handleXSINoNamespaceSchemaLocation( utf16_to_utf8( xsiNoNamespaceSchemaLocation ) );
+            handleXSINoNamespaceSchemaLocation( *xsiNoNamespaceSchemaLocation );
     }
 }
 
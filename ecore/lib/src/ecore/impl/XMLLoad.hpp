@@ -11,12 +11,10 @@
 #define ECORE_ABSTRACTXMLLOAD_HPP_
 
 #include "ecore/Any.hpp"
+#include "ecore/EResource.hpp"
+#include "ecore/impl/XMLHandler.hpp"
 #include "ecore/impl/XMLNamespaces.hpp"
 
-#include <xercesc/sax/Locator.hpp>
-#include <xercesc/sax2/Attributes.hpp>
-#include <xercesc/sax2/DefaultHandler.hpp>
-
 #include <stack>
 #include <string>
 #include <unordered_map>
@@ -30,6 +28,7 @@ namespace ecore
     class EObject;
     class EPackageRegistry;
     class EReference;
+    class EResourceStatistics;
     class EStructuralFeature;
 
 } // namespace ecore
@@ -38,45 +37,45 @@ namespace ecore::impl
 {
     class XMLResource;
 
-    class XMLLoad : public xercesc::DefaultHandler
+    class XMLLoad : public XMLHandler
     {
     public:
-        XMLLoad( XMLResource& resource );
+        XMLLoad( XMLResource& resource, const EResource::Options& options );
 
         virtual ~XMLLoad();
 
-        virtual void setDocumentLocator( const xercesc::Locator* const locator );
+        virtual void setDocumentLocator( const XMLLocator* locator );
 
         virtual void startDocument();
 
         virtual void endDocument();
 
-        virtual void startElement( const XMLCh* const uri,
-                                   const XMLCh* const localname,
-                                   const XMLCh* const qname,
-                                   const xercesc::Attributes& attrs );
-
-        virtual void endElement( const XMLCh* const uri, const XMLCh* const localname, const XMLCh* const qname );
+        virtual void startPrefixMapping( const std::string& prefix, const std::string& uri );
 
-        virtual void startPrefixMapping( const XMLCh* const prefix, const XMLCh* const uri );
+        virtual void startElement( const std::string& uri,
+                                   const std::string& localName,
+                                   const std::string& qName,
+                                   const XMLAttributes& attributes );
 
-        virtual void endPrefixMapping( const XMLCh* const prefix );
+        virtual void endElement( const std::string& uri, const std::string& localName, const std::string& qName );
 
-        virtual void characters( const XMLCh* const chars, const XMLSize_t length );
+        virtual void error( const std::string& message, int line, int column );
 
-        virtual void error( const xercesc::SAXParseException& exc );
+        virtual void warning( const std::string& message, int line, int column );
 
-        virtual void fatalError( const xercesc::SAXParseException& exc );
-
-        virtual void warning( const xercesc::SAXParseException& exc );
+        // a delta updates the objects of the resource written by XMLSave::saveDelta
+        void setDelta( bool isDelta );
 
     protected:
+        struct Reference;
+        struct ReferenceID;
 
-    
-
-        const xercesc::Attributes* setAttributes( const xercesc::Attributes* attrs );
-        void startElement( const std::string uri, const std::string& localName, const std::string& qname );
+        const XMLAttributes* setAttributes( const XMLAttributes* attrs );
+        void startElement( const std::string& uri, const std::string& localName, const std::string& qname );
         void processElement( const std::string& name, const std::string& prefix, const std::string& localName );
+        void processDeltaElement( const std::string& prefix, const std::string& localName );
+        void resetFeatures( const std::shared_ptr<EObject>& eObject, bool isContentsModified );
+        std::string getDeltaAttribute( const char* localName, const char* qName ) const;
 
         void handleNamespaces();
         void handleNamespace( const std::string prefix, const std::string& uri );
@@ -132,28 +131,36 @@ namespace ecore::impl
         void handleUnknownPackage( const std::string& name );
 
         void handleReferences();
+        void enableNotifications();
+        void handleManyReference( const Reference& reference, FeatureKind kind );
+        std::shared_ptr<EObject> getEObject( const Reference& reference, const ReferenceID& id );
+        std::shared_ptr<EObject> getEObject( const std::string& uriFragment );
 
         void error( const std::shared_ptr<EDiagnostic>& diagnostic );
         void warning( const std::shared_ptr<EDiagnostic>& diagnostic );
 
     protected:
-        struct Reference;
-
         XMLResource& resource_;
+        EResourceStatistics* statistics_;
         XMLNamespaces namespaces_;
-        const xercesc::Locator* locator_{nullptr};
-        const xercesc::Attributes* attributes_{nullptr};
+        const XMLLocator* locator_{nullptr};
+        const XMLAttributes* attributes_{nullptr};
         bool isResolveDeferred_{false};
         bool isPushContext_{false};
         bool isRoot_{false};
         bool isNamespaceAware_{false};
+        bool isDelta_{false};
+        bool isDisableNotify_{false};
         std::shared_ptr<EPackageRegistry> packageRegistry_;
         std::unordered_map<std::string, std::shared_ptr<EFactory>> prefixesToFactories_;
-        std::stack<std::string> elements_;
         std::stack<std::shared_ptr<EObject>> objects_;
         std::vector<std::shared_ptr<EObject>> sameDocumentProxies_;
+        std::vector<std::shared_ptr<EObject>> undeliveredObjects_;
         std::vector<Reference> references_;
+        std::unordered_map<std::string, std::shared_ptr<EObject>> objectsByID_;
+        bool isObjectsByIDBuilt_{false};
         std::unordered_set<std::string> notFeatures_;
+        std::string id_;
     };
 } // namespace ecore::impl
 
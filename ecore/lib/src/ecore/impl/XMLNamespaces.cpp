@@ -3,6 +3,11 @@
 using namespace ecore;
 using namespace ecore::impl;
 
+namespace
+{
+    const std::string EMPTY;
+}
+
 void XMLNamespaces::pushContext()
 {
     if( currentContext_ + 1 == contexts_.size() )
@@ -10,49 +15,72 @@ void XMLNamespaces::pushContext()
     contexts_[++currentContext_] = namespacesSize_;
 }
 
-std::vector<std::pair<std::string, std::string>> XMLNamespaces::popContext()
+XMLNamespaces::Context XMLNamespaces::popContext()
 {
     int oldPrefixSize = namespacesSize_;
     namespacesSize_ = contexts_[currentContext_--];
-    return std::vector<std::pair<std::string, std::string>>( namespaces_.begin() + namespacesSize_,
-                                                                   namespaces_.begin() + oldPrefixSize );
+
+    // restore the declarations shadowed by the popped ones
+    for( int i = oldPrefixSize; i > namespacesSize_; --i )
+    {
+        prefixes_[namespaces_[i - 1].first] = shadowed_[i - 1].prefix_;
+        unbindURI( i - 1 );
+    }
+    return Context( namespaces_.begin() + namespacesSize_, namespaces_.begin() + oldPrefixSize );
 }
 
 bool XMLNamespaces::declarePrefix( const std::string& prefix, const std::string& uri )
 {
-    for( int i = namespacesSize_; i > contexts_[currentContext_]; --i )
+    auto& index = prefixes_.try_emplace( prefix, -1 ).first->second;
+    if( index != -1 && index >= contexts_[currentContext_] )
     {
-        auto& p = namespaces_[i - 1];
-        if( p.first == prefix )
-        {
-            p.second = uri;
-            return true;
-        }
+        unbindURI( index );
+        namespaces_[index].second = uri;
+        bindURI( index );
+        return true;
     }
     if( namespacesSize_ + 1 == namespaces_.size() )
+    {
         namespaces_.resize( namespaces_.size() * 2 );
-    namespaces_[namespacesSize_++] = std::make_pair( prefix, uri );
+        shadowed_.resize( shadowed_.size() * 2 );
+    }
+    // strings of a popped namespace are reused
+    auto i = namespacesSize_++;
+    auto& p = namespaces_[i];
+    p.first = prefix;
+    p.second = uri;
+    shadowed_[i].prefix_ = index;
+    index = i;
+    bindURI( i );
     return false;
 }
 
-std::string XMLNamespaces::getPrefix( const std::string& uri )
+const std::string& XMLNamespaces::getPrefix( const std::string& uri ) const
 {
-    for( int i = namespacesSize_; i > 0; --i )
-    {
-        auto& p = namespaces_[i - 1];
-        if( p.second == uri )
-            return p.first;
-    }
-    return std::string();
+    auto it = uris_.find( uri );
+    return it != uris_.end() && it->second != -1 ? namespaces_[it->second].first : EMPTY;
 }
 
-std::string XMLNamespaces::getURI( const std::string& prefix )
+const std::string& XMLNamespaces::getURI( const std::string& prefix ) const
 {
-    for( int i = namespacesSize_; i > 0; --i )
-    {
-        auto& p = namespaces_[i - 1];
-        if( p.first == prefix )
-            return p.second;
-    }
-    return std::string();
-}
\ No newline at end of file
+    auto it = prefixes_.find( prefix );
+    return it != prefixes_.end() && it->second != -1 ? namespaces_[it->second].second : EMPTY;
+}
+
+// the declarations of a uri are linked from the latest to the oldest
+void XMLNamespaces::bindURI( int index )
+{
+    auto* next = &uris_.try_emplace( namespaces_[index].second, -1 ).first->second;
+    while( *next > index )
+        next = &shadowed_[*next].uri_;
+    shadowed_[index].uri_ = *next;
+    *next = index;
+}
+
+void XMLNamespaces::unbindURI( int index )
+{
+    auto* next = &uris_[namespaces_[index].second];
+    while( *next != index )
+        next = &shadowed_[*next].uri_;
+    *next = shadowed_[index].uri_;
+}
@@ -12,16 +12,54 @@
 
 #include "ecore/Exports.hpp"
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace ecore::impl
 {
+    // Scoped namespaces : the latest declaration of each prefix and of each uri is found by hash
+    // and the shadowed ones are linked to it so that a popped context restores them.
     class ECORE_API XMLNamespaces
     {
+    public:
+        using Namespace = std::pair<std::string, std::string>;
+
+        // the namespaces of a popped context : they are valid until the next declaration
+        class Context
+        {
+        public:
+            using const_iterator = std::vector<Namespace>::const_iterator;
+
+            Context( const_iterator begin, const_iterator end )
+                : begin_( begin )
+                , end_( end )
+            {
+            }
+
+            const_iterator begin() const
+            {
+                return begin_;
+            }
+
+            const_iterator end() const
+            {
+                return end_;
+            }
+
+            bool empty() const
+            {
+                return begin_ == end_;
+            }
+
+        private:
+            const_iterator begin_;
+            const_iterator end_;
+        };
+
     public:
         void pushContext();
 
-        std::vector<std::pair<std::string, std::string>> popContext();
+        Context popContext();
 
          /**
             @param prefix prefix to declare
@@ -32,13 +70,30 @@ namespace ecore::impl
          */
         bool declarePrefix( const std::string& prefix, const std::string& uri );
 
-        std::string getPrefix( const std::string& uri );
+        // the returned strings are valid until the next declaration
+        const std::string& getPrefix( const std::string& uri ) const;
+
+        const std::string& getURI( const std::string& prefix ) const;
+
+    private:
+        // declarations shadowed by a namespace
+        struct Shadowed
+        {
+            int prefix_;
+            int uri_;
+        };
 
-        std::string getURI( const std::string& prefix );
+        void bindURI( int index );
+        void unbindURI( int index );
 
     private:
-        std::vector<std::pair<std::string, std::string>> namespaces_{16};
+        std::vector<Namespace> namespaces_{16};
+        std::vector<Shadowed> shadowed_{16};
         int namespacesSize_{0};
+        // index of the latest declaration of a prefix or a uri, -1 if there's none :
+        // entries are kept so that each prefix and uri is allocated once
+        std::unordered_map<std::string, int> prefixes_;
+        std::unordered_map<std::string, int> uris_;
         std::vector<int> contexts_{8};
         int currentContext_{-1};
     };
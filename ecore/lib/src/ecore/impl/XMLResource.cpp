@@ -1,19 +1,24 @@
 #include "ecore/impl/XMLResource.hpp"
-#include "ecore/impl/SaxParserPool.hpp"
+#include "ecore/impl/NativeXMLParser.hpp"
+#include "ecore/impl/ResourceStatistics.hpp"
 #include "ecore/impl/XMLLoad.hpp"
-#include "ecore/impl/XMLInputSource.hpp"
 #include "ecore/impl/XMLSave.hpp"
+#include "ecore/impl/XercesXMLParser.hpp"
 
 using namespace ecore;
 using namespace ecore::impl;
 
 XMLResource::XMLResource()
     : AbstractResource()
+    , isParallelSave_( false )
+    , parser_( Parser::XERCES )
 {
 }
 
 XMLResource::XMLResource( const URI& uri )
     : AbstractResource( uri )
+    , isParallelSave_( false )
+    , parser_( Parser::XERCES )
 {
 }
 
@@ -21,32 +26,72 @@ XMLResource::~XMLResource()
 {
 }
 
-void XMLResource::doLoad( std::istream& is )
+bool XMLResource::isParallelSave() const
 {
-    auto& pool = SaxParserPool::getInstance();
-    auto parser = pool.getParser();
-    auto& reader = parser->getReader();
+    return isParallelSave_;
+}
+
+void XMLResource::setParallelSave( bool isParallelSave )
+{
+    isParallelSave_ = isParallelSave;
+}
 
-    auto xmlLoad = createXMLLoad();
-    reader.setContentHandler( xmlLoad.get() );
-    
-    XMLInputSource source( is );
-    reader.parse( source );
+XMLResource::Parser XMLResource::getParser() const
+{
+    return parser_;
+}
+
+void XMLResource::setParser( Parser parser )
+{
+    parser_ = parser;
+}
+
+void XMLResource::doLoad( std::istream& is, const Options& options )
+{
+    auto xmlLoad = createXMLLoad( options );
+    parse( is, *xmlLoad, options );
 }
 
-void XMLResource::doSave( std::ostream& os )
+void XMLResource::doSave( std::ostream& os, const Options& options )
 {
-    auto xmlSave = createXMLSave();
+    auto xmlSave = createXMLSave( options );
     xmlSave->save( os );
 }
 
-std::unique_ptr<XMLLoad> XMLResource::createXMLLoad()
+void XMLResource::doLoadDelta( std::istream& is, const Options& options )
+{
+    auto xmlLoad = createXMLLoad( options );
+    xmlLoad->setDelta( true );
+    parse( is, *xmlLoad, options );
+}
+
+void XMLResource::doSaveDelta( std::ostream& os,
+                               const Options& options,
+                               bool isContentsModified,
+                               const std::vector<ModifiedObject>& modifiedObjects )
+{
+    auto xmlSave = createXMLSave( options );
+    xmlSave->saveDelta( os, isContentsModified, modifiedObjects );
+}
+
+void XMLResource::parse( std::istream& is, XMLLoad& xmlLoad, const Options& options )
+{
+    auto statistics = getStatistics().get();
+    PhaseTimer timer( statistics, EResourceStatistics::Phase::PARSE );
+
+    if( getOption( options, OPTION_PARSER, parser_ ) == Parser::NATIVE )
+        NativeXMLParser().parse( is, xmlLoad, statistics );
+    else
+        XercesXMLParser().parse( is, xmlLoad, statistics );
+}
+
+std::unique_ptr<XMLLoad> XMLResource::createXMLLoad( const Options& options )
 {
-    return std::move( std::make_unique<XMLLoad>(*this) );
+    return std::move( std::make_unique<XMLLoad>( *this, options ) );
 }
 
-std::unique_ptr<XMLSave> ecore::impl::XMLResource::createXMLSave()
+std::unique_ptr<XMLSave> ecore::impl::XMLResource::createXMLSave( const Options& options )
 {
-    return std::move( std::make_unique<XMLSave>( *this ) );
+    return std::move( std::make_unique<XMLSave>( *this, options ) );
 }
 
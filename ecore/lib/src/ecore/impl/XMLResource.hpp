@@ -23,6 +23,32 @@ namespace ecore::impl
 
     class ECORE_API XMLResource : public AbstractResource
     {
+    public:
+        // the parser of the loaded documents : XERCES transcodes them from and to utf-16,
+        // NATIVE reads utf-8 documents in place and rejects other encodings
+        enum class Parser
+        {
+            XERCES,
+            NATIVE
+        };
+
+        // load option : the Parser of the document, defaults to getParser()
+        static constexpr const char* OPTION_PARSER = "PARSER";
+
+        // load option : when true, the references are added without checking their opposites, defaults to false
+        static constexpr const char* OPTION_DEFER_IDREF_RESOLUTION = "DEFER_IDREF_RESOLUTION";
+
+        // load option : when true, the loaded objects send no notification until the end of the load,
+        // where they receive the content adapters of their container, defaults to false
+        static constexpr const char* OPTION_DISABLE_NOTIFY = "DISABLE_NOTIFY";
+
+        // save option : when true, the unset attributes with a default value are saved, defaults to false
+        static constexpr const char* OPTION_KEEP_DEFAULT_CONTENT = "KEEP_DEFAULT_CONTENT";
+
+        // save option : when true, large lists of contained objects are saved by several threads,
+        // defaults to isParallelSave()
+        static constexpr const char* OPTION_PARALLEL_SAVE = "PARALLEL_SAVE";
+
     public:
         XMLResource();
 
@@ -30,16 +56,49 @@ namespace ecore::impl
 
         virtual ~XMLResource();
 
+        // when set, large lists of contained objects are saved by several threads : the result is the same
+        bool isParallelSave() const;
+
+        void setParallelSave( bool isParallelSave );
+
+        Parser getParser() const;
+
+        void setParser( Parser parser );
+
+        // the value of an option, or defaultValue when it is not set or not of type T
+        template <typename T>
+        static T getOption( const Options& options, const std::string& name, const T& defaultValue )
+        {
+            auto it = options.find( name );
+            if( it == options.end() )
+                return defaultValue;
+            auto value = _anyCast<T>( &it->second );
+            return value ? *value : defaultValue;
+        }
+
     protected:
         // Inherited via AbstractResource
-        virtual void doLoad( std::istream & is ) override;
+        virtual void doLoad( std::istream & is, const Options& options ) override;
+
+        virtual void doSave( std::ostream & os, const Options& options ) override;
+
+        virtual void doLoadDelta( std::istream& is, const Options& options ) override;
+
+        virtual void doSaveDelta( std::ostream& os,
+                                  const Options& options,
+                                  bool isContentsModified,
+                                  const std::vector<ModifiedObject>& modifiedObjects ) override;
 
-        virtual void doSave( std::ostream & os ) override;
+        virtual std::unique_ptr<XMLLoad> createXMLLoad( const Options& options );
 
-        virtual std::unique_ptr<XMLLoad> createXMLLoad();
+        virtual std::unique_ptr<XMLSave> createXMLSave( const Options& options );
 
-        virtual std::unique_ptr<XMLSave> createXMLSave();
+    private:
+        void parse( std::istream& is, XMLLoad& xmlLoad, const Options& options );
 
+    private:
+        bool isParallelSave_;
+        Parser parser_;
     };
 
 } // namespace ecore::impl
@@ -10,12 +10,18 @@
 #include "ecore/EReference.hpp"
 #include "ecore/EStructuralFeature.hpp"
 #include "ecore/EcorePackage.hpp"
+#include "ecore/impl/AbstractResource.hpp"
 #include "ecore/impl/EObjectInternal.hpp"
+#include "ecore/impl/PrimitiveConverter.hpp"
+#include "ecore/impl/ResourceStatistics.hpp"
 #include "ecore/impl/XMLResource.hpp"
 
+#include <algorithm>
+#include <future>
 #include <iterator>
 #include <memory>
 #include <optional>
+#include <thread>
 
 using namespace ecore;
 using namespace ecore::impl;
@@ -25,12 +31,46 @@ namespace
     static constexpr char* XSI_URI = "http://www.w3.org/2001/XMLSchema-instance";
     static constexpr char* XSI_NS = "xsi";
     static constexpr char* XML_NS = "xmlns";
+    static constexpr char* DELTA_URI = "http://www.masagroup.net/ecore/delta";
+    static constexpr char* DELTA_NS = "xmlns:delta";
+    static constexpr char* DELTA_ELEMENT = "delta:Delta";
+    static constexpr char* FRAGMENT_ATTRIB = "delta:fragment";
+    static constexpr char* CONTENTS_ATTRIB = "delta:contents";
+
+    // below this number of objects per thread, a list of contained objects is saved sequentially
+    static constexpr std::size_t MIN_FORK_SIZE = 64;
 } // namespace
 
-XMLSave::XMLSave( XMLResource& resource )
+XMLSave::XMLSave( XMLResource& resource, const EResource::Options& options )
     : resource_( resource )
-    , keepDefaults_( false )
-{
+    , statistics_( resource.getStatistics().get() )
+    , keepDefaults_( XMLResource::getOption( options, XMLResource::OPTION_KEEP_DEFAULT_CONTENT, false ) )
+    , isContainmentSaved_( true )
+    , isParallel_( XMLResource::getOption( options, XMLResource::OPTION_PARALLEL_SAVE, resource.isParallelSave() ) )
+    , isForked_( false )
+{
+}
+
+XMLSave::XMLSave( const XMLSave& parent, XMLString&& str )
+    : resource_( parent.resource_ )
+    , statistics_( nullptr )
+    , str_( std::move( str ) )
+    , packages_( parent.packages_ )
+    , uriToPrefixes_( parent.uriToPrefixes_ )
+    , prefixesToURI_( parent.prefixesToURI_ )
+    , classPlans_( parent.classPlans_ )
+    , uriFragments_( parent.uriFragments_ )
+    , keepDefaults_( parent.keepDefaults_ )
+    , isContainmentSaved_( parent.isContainmentSaved_ )
+    , isParallel_( false )
+    , isForked_( true )
+{
+    // statistics are not thread safe : a fork counts its own ones
+    if( parent.statistics_ )
+    {
+        forkStatistics_ = std::make_unique<ResourceStatistics>();
+        statistics_ = forkStatistics_.get();
+    }
 }
 
 XMLSave::~XMLSave()
@@ -43,19 +83,82 @@ void XMLSave::save( std::ostream& o )
     if( !c || c->empty() )
         return;
 
-    // header
-    saveHeader();
+    {
+        PhaseTimer timer( statistics_, EResourceStatistics::Phase::SERIALIZE );
+
+        // header
+        saveHeader();
+
+        // content
+        auto object = c->get( 0 );
+        auto mark = saveTopObject( object );
+
+        // namespace
+        str_.resetToMark( mark );
+        saveNamespaces();
+    }
+
+    // write result
+    write( o );
+}
+
+void XMLSave::saveDelta( std::ostream& o,
+                         bool isContentsModified,
+                         const std::vector<AbstractResource::ModifiedObject>& modifiedObjects )
+{
+    {
+        PhaseTimer timer( statistics_, EResourceStatistics::Phase::SERIALIZE );
+
+        // header
+        saveHeader();
+
+        // content
+        str_.startElement( DELTA_ELEMENT );
+        auto mark = str_.mark();
+        if( isContentsModified )
+        {
+            str_.addAttribute( CONTENTS_ATTRIB, "true" );
+            for( const auto& eObject : *resource_.getContents() )
+                saveTopObject( eObject );
+        }
+        else
+        {
+            // when no subtree is written, a delta references a few objects of the resource :
+            // their fragments are computed on demand rather than for the whole resource
+            if( std::none_of( modifiedObjects.begin(), modifiedObjects.end(), []( const auto& m ) { return m.isContentsModified_; } ) )
+                uriFragments_.emplace( static_cast<EResource*>( &resource_ ), std::make_shared<const URIFragments>() );
 
-    // content
-    auto object = c->get( 0 );
-    auto mark = saveTopObject( object );
+            for( const auto& modifiedObject : modifiedObjects )
+                saveModifiedObject( modifiedObject.eObject_, modifiedObject.isContentsModified_ );
+        }
+        str_.endElement();
 
-    // namespace
-    str_.resetToMark( mark );
-    saveNamespaces();
+        // namespace
+        str_.resetToMark( mark );
+        str_.addAttribute( DELTA_NS, DELTA_URI );
+        saveNamespaces();
+    }
 
     // write result
-    str_.write( o );
+    write( o );
+}
+
+bool XMLSave::join( XMLSave& fork )
+{
+    // the namespaces found by the fork are added in the order a sequential save would have found them :
+    // its output is kept only if they got the same prefixes
+    for( const auto& discovery : fork.discoveries_ )
+    {
+        if( !discovery.ePackage_ )
+            addXSINamespace();
+        else if( getPrefix( discovery.ePackage_, discovery.mustHavePrefix_ ) != discovery.prefix_ )
+            return false;
+    }
+
+    str_.join( fork.str_ );
+    if( statistics_ )
+        fork.forkStatistics_->report( *statistics_ );
+    return true;
 }
 
 void XMLSave::saveHeader()
@@ -64,10 +167,18 @@ void XMLSave::saveHeader()
     str_.addLine();
 }
 
+void XMLSave::write( std::ostream& o )
+{
+    PhaseTimer timer( statistics_, EResourceStatistics::Phase::WRITE );
+    auto size = str_.write( o );
+    if( statistics_ )
+        statistics_->bytesWritten( size );
+}
+
 std::shared_ptr<XMLString::Segment> XMLSave::saveTopObject( const std::shared_ptr<EObject>& eObject )
 {
     auto eClass = eObject->eClass();
-    auto name = getQName( eClass );
+    const auto& name = getQName( eClass );
     str_.startElement( name );
     auto mark = str_.mark();
     saveElementID( eObject );
@@ -75,6 +186,21 @@ std::shared_ptr<XMLString::Segment> XMLSave::saveTopObject( const std::shared_pt
     return mark;
 }
 
+void XMLSave::saveModifiedObject( const std::shared_ptr<EObject>& eObject, bool isContentsModified )
+{
+    auto eClass = eObject->eClass();
+    str_.startElement( getQName( eClass ) );
+    str_.addAttribute( FRAGMENT_ATTRIB, getURIFragment( resource_.getThisPtr(), eObject ) );
+    if( isContentsModified )
+        str_.addAttribute( CONTENTS_ATTRIB, "true" );
+    saveElementID( eObject );
+
+    // the contents of an object are only written with it when they are modified
+    isContainmentSaved_ = isContentsModified;
+    saveFeatures( eObject, false );
+    isContainmentSaved_ = true;
+}
+
 void XMLSave::saveNamespaces()
 {
     for( auto p : prefixesToURI_ )
@@ -87,38 +213,30 @@ void XMLSave::saveElementID( const std::shared_ptr<EObject>& eObject )
 
 bool XMLSave::saveFeatures( const std::shared_ptr<EObject>& eObject, bool attributesOnly )
 {
-    auto eClass = eObject->eClass();
-    auto eAllFeatures = eClass->getEAllStructuralFeatures();
-    std::optional<std::vector<int>> elementFeatures;
-    auto elementCount = 0;
-    auto i = 0;
-    for( auto it = std::begin( *eAllFeatures ); it != std::end( *eAllFeatures ); ++it, ++i )
+    const auto& plan = getClassPlan( eObject->eClass() );
+
+    // element features of the object are pushed after the ones of its containers and popped once written
+    auto begin = elementFeatures_.size();
+    for( const auto& feature : plan.features_ )
     {
-        // current feature
-        auto eFeature = *it;
-      
-        FeatureKind kind;
-        auto itFound = featureKinds_.find( eFeature );
-        if( itFound == featureKinds_.end() )
-        {
-            kind = featureKinds_[eFeature] = getFeatureKind( eFeature );
-        }
-        else
-        {
-            kind = itFound->second;
-        }
+        auto kind = feature.kind_;
+        if( !isContainmentSaved_
+            && ( kind == OBJECT_CONTAIN_SINGLE || kind == OBJECT_CONTAIN_MANY || kind == OBJECT_CONTAIN_SINGLE_UNSETTABLE
+                 || kind == OBJECT_CONTAIN_MANY_UNSETTABLE ) )
+            continue;
 
+        const auto& eFeature = feature.eFeature_;
         if( kind != TRANSIENT && shouldSaveFeature( eObject, eFeature ) )
         {
             switch( kind )
             {
             case DATATYPE_SINGLE:
-                saveDataTypeSingle( eObject, eFeature );
+                saveDataTypeSingle( eObject, feature );
                 continue;
             case DATATYPE_SINGLE_NILLABLE:
                 if( !isNil( eObject, eFeature ) )
                 {
-                    saveDataTypeSingle( eObject, eFeature );
+                    saveDataTypeSingle( eObject, feature );
                     continue;
                 }
                 break;
@@ -126,7 +244,7 @@ bool XMLSave::saveFeatures( const std::shared_ptr<EObject>& eObject, bool attrib
             case DATATYPE_MANY:
                 if( isEmpty( eObject, eFeature ) )
                 {
-                    saveManyEmpty( eObject, eFeature );
+                    saveManyEmpty( eObject, feature );
                     continue;
                 }
                 break;
@@ -143,7 +261,7 @@ bool XMLSave::saveFeatures( const std::shared_ptr<EObject>& eObject, bool attrib
                 case CROSS:
                     break;
                 case SAME:
-                    saveIDRefSingle( eObject, eFeature );
+                    saveIDRefSingle( eObject, feature );
                     continue;
                 default:
                     continue;
@@ -152,7 +270,7 @@ bool XMLSave::saveFeatures( const std::shared_ptr<EObject>& eObject, bool attrib
             case OBJECT_HREF_MANY_UNSETTABLE:
                 if( isEmpty( eObject, eFeature ) )
                 {
-                    saveManyEmpty( eObject, eFeature );
+                    saveManyEmpty( eObject, feature );
                     continue;
                 }
             case OBJECT_HREF_MANY:
@@ -161,7 +279,7 @@ bool XMLSave::saveFeatures( const std::shared_ptr<EObject>& eObject, bool attrib
                 case CROSS:
                     break;
                 case SAME:
-                    saveIDRefMany( eObject, eFeature );
+                    saveIDRefMany( eObject, feature );
                     continue;
                 default:
                     continue;
@@ -174,116 +292,110 @@ bool XMLSave::saveFeatures( const std::shared_ptr<EObject>& eObject, bool attrib
             {
                 continue;
             }
-            if( !elementFeatures )
-            {
-                elementFeatures = std::vector<int>( eAllFeatures->size() );
-            }
-            elementFeatures->operator[]( elementCount++ ) = i;
+            elementFeatures_.push_back( &feature );
         }
     }
-    if( !elementFeatures )
+    auto end = elementFeatures_.size();
+    if( begin == end )
     {
         str_.endEmptyElement();
         return false;
     }
-    for( auto i = 0; i < elementCount; i++ )
+    for( auto i = begin; i < end; i++ )
     {
-        auto eFeature = eAllFeatures->get( elementFeatures->operator[]( i ) );
-        auto kind = featureKinds_[eFeature];
-        switch( kind )
+        const auto& feature = *elementFeatures_[i];
+        const auto& eFeature = feature.eFeature_;
+        switch( feature.kind_ )
         {
         case DATATYPE_SINGLE_NILLABLE:
-            saveNil( eObject, eFeature );
+            saveNil( eObject, feature );
             break;
         case DATATYPE_MANY:
-            saveDataTypeMany( eObject, eFeature );
+            saveDataTypeMany( eObject, feature );
             break;
         case OBJECT_CONTAIN_SINGLE_UNSETTABLE:
             if( isNil( eObject, eFeature ) )
             {
-                saveNil( eObject, eFeature );
+                saveNil( eObject, feature );
                 break;
             }
         case OBJECT_CONTAIN_SINGLE:
-            saveContainedSingle( eObject, eFeature );
+            saveContainedSingle( eObject, feature );
             break;
         case OBJECT_CONTAIN_MANY_UNSETTABLE:
         case OBJECT_CONTAIN_MANY:
-            saveContainedMany( eObject, eFeature );
+            saveContainedMany( eObject, feature );
             break;
         case OBJECT_HREF_SINGLE_UNSETTABLE:
             if( isNil( eObject, eFeature ) )
             {
-                saveNil( eObject, eFeature );
+                saveNil( eObject, feature );
                 break;
             }
         case OBJECT_HREF_SINGLE:
-            saveHRefSingle( eObject, eFeature );
+            saveHRefSingle( eObject, feature );
             break;
         case OBJECT_HREF_MANY_UNSETTABLE:
         case OBJECT_HREF_MANY:
-            saveHRefMany( eObject, eFeature );
+            saveHRefMany( eObject, feature );
             break;
         }
     }
+    elementFeatures_.resize( begin );
 
     str_.endElement();
     return true;
 }
 
-void XMLSave::saveDataTypeSingle( const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature )
+void XMLSave::saveDataTypeSingle( const std::shared_ptr<EObject>& eObject, const FeaturePlan& feature )
 {
-    auto val = eObject->eGet( eFeature, false );
-    auto d = getDataType( val, eFeature, true );
+    auto val = eObject->eGet( feature.eFeature_, false );
+    auto d = getDataType( val, feature, true );
     if( !d.empty() )
-        str_.addAttribute( getQName( eFeature ), d );
+        str_.addAttribute( feature.qName_, d );
 }
 
-void XMLSave::saveDataTypeMany( const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature )
+void XMLSave::saveDataTypeMany( const std::shared_ptr<EObject>& eObject, const FeaturePlan& feature )
 {
-    auto val = eObject->eGet( eFeature, false );
+    auto val = eObject->eGet( feature.eFeature_, false );
     auto l = anyCast<std::shared_ptr<EList<Any>>>( val );
-    auto d = std::dynamic_pointer_cast<EDataType>( eFeature->getEType() );
-    auto p = d->getEPackage();
-    auto f = p->getEFactoryInstance();
-    auto name = getQName( eFeature );
     for( auto value : *l )
     {
         if( value.empty() )
         {
-            str_.startElement( name );
+            str_.startElement( feature.qName_ );
             str_.addAttribute( "xsi:nil", "true" );
             str_.endEmptyElement();
-            uriToPrefixes_[XSI_URI] = {XSI_NS};
-            prefixesToURI_[XSI_NS] = XSI_URI;
+            addXSINamespace();
         }
         else
         {
-            auto str = f->convertToString( d, value );
-            str_.addContent( name, str );
+            str_.addContent( feature.qName_, convertToString( feature, value ) );
+            if( statistics_ )
+                statistics_->attributeConverted();
         }
     }
 }
 
-void XMLSave::saveManyEmpty( const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature )
+void XMLSave::saveManyEmpty( const std::shared_ptr<EObject>& eObject, const FeaturePlan& feature )
 {
-    str_.addAttribute( getQName( eFeature ), "" );
+    str_.addAttribute( feature.qName_, "" );
 }
 
-void XMLSave::saveEObjectSingle( const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature )
+void XMLSave::saveEObjectSingle( const std::shared_ptr<EObject>& eObject, const FeaturePlan& feature )
 {
-    auto val = eObject->eGet( eFeature , false );
+    auto val = eObject->eGet( feature.eFeature_ , false );
     auto obj = anyObjectCast<std::shared_ptr<EObject>>( val );
     if( obj )
     {
         auto id = getHRef( obj );
-        str_.addAttribute( getQName( eFeature ), "" );
+        str_.addAttribute( feature.qName_, "" );
     }
 }
 
-void XMLSave::saveEObjectMany( const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature )
+void XMLSave::saveEObjectMany( const std::shared_ptr<EObject>& eObject, const FeaturePlan& feature )
 {
-    auto val = eObject->eGet( eFeature , false );
+    auto val = eObject->eGet( feature.eFeature_ , false );
     auto l = anyListCast<std::shared_ptr<EObject>>( val );
     auto failure = false;
     std::string s = "";
@@ -304,39 +416,147 @@ void XMLSave::saveEObjectMany( const std::shared_ptr<EObject>& eObject, const st
         }
     }
     if( !failure && !s.empty() )
-        str_.addAttribute( getQName( eFeature ), s );
+        str_.addAttribute( feature.qName_, s );
 }
 
-void XMLSave::saveNil( const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature )
+void XMLSave::saveNil( const std::shared_ptr<EObject>& eObject, const FeaturePlan& feature )
 {
-    str_.addNil( getQName( eFeature ) );
+    str_.addNil( feature.qName_ );
 }
 
-void XMLSave::saveContainedSingle( const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature )
+void XMLSave::saveContainedSingle( const std::shared_ptr<EObject>& eObject, const FeaturePlan& feature )
 {
-    auto val = eObject->eGet( eFeature , false );
+    auto val = eObject->eGet( feature.eFeature_ , false );
     auto obj = anyObjectCast<std::shared_ptr<EObject>>( val );
     if (obj)
-        saveEObject(obj, eFeature);
+        saveEObject(obj, feature);
 }
 
-void XMLSave::saveContainedMany( const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature )
+void XMLSave::saveContainedMany( const std::shared_ptr<EObject>& eObject, const FeaturePlan& feature )
 {
-    auto val = eObject->eGet( eFeature, false );
+    auto val = eObject->eGet( feature.eFeature_, false );
     auto l = anyListCast<std::shared_ptr<EObject>>( val );
-    for (auto obj : l)
-        saveEObject(obj, eFeature);
+    auto nbForks = isParallel_ ? std::min<std::size_t>( std::thread::hardware_concurrency(), l->size() / MIN_FORK_SIZE ) : 0;
+    if( nbForks > 1 )
+        saveContainedManyParallel( l, feature, nbForks );
+    else
+    {
+        for( auto obj : l )
+            saveEObject( obj, feature );
+    }
 }
 
-void XMLSave::saveEObject( const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature )
+void XMLSave::saveContainedManyParallel( const std::shared_ptr<EList<std::shared_ptr<EObject>>>& eObjects,
+                                         const FeaturePlan& feature,
+                                         std::size_t nbForks )
+{
+    // fragments of the resource are shared by the forks : they are computed before
+    getURIFragments( resource_.getThisPtr() );
+
+    // meta model caches and fragments of the other resources are filled lazily :
+    // they are filled by this thread before the forks read them
+    for( const auto& eObject : *eObjects )
+        prepareFork( eObject );
+
+    // each fork saves a range of the objects in its own string, they are joined in order.
+    // forks are declared first : their threads are waited for before they are destroyed
+    auto size = eObjects->size();
+    std::vector<std::unique_ptr<XMLSave>> forks;
+    std::vector<std::future<void>> results;
+    forks.reserve( nbForks );
+    results.reserve( nbForks );
+    for( std::size_t i = 0; i < nbForks; ++i )
+    {
+        auto fork = forks.emplace_back( new XMLSave( *this, str_.fork() ) ).get();
+        results.push_back( std::async( std::launch::async, [fork, &eObjects, &feature, begin = size * i / nbForks, end = size * ( i + 1 ) / nbForks]() {
+            for( auto j = begin; j < end; ++j )
+                fork->saveEObject( eObjects->get( j ), feature );
+        } ) );
+    }
+
+    for( std::size_t i = 0; i < nbForks; ++i )
+    {
+        results[i].get();
+        if( !join( *forks[i] ) )
+        {
+            // a namespace prefix depends on the ones found before : the range is saved again sequentially
+            for( auto j = size * i / nbForks; j < size * ( i + 1 ) / nbForks; ++j )
+                saveEObject( eObjects->get( j ), feature );
+        }
+    }
+}
+
+void XMLSave::prepareFork( const std::shared_ptr<EObject>& eObject )
+{
+    if( eObject->eIsProxy() )
+        return;
+
+    if( auto eResource = eObject->getInternal().eInternalResource() )
+    {
+        // saved as a href
+        getURIFragments( eResource );
+        return;
+    }
+
+    // plans don't look for the package prefixes : namespaces are still declared in the order of the save
+    auto eClass = eObject->eClass();
+    const auto& plan = getClassPlan( eClass );
+    eClass->getEIDAttribute();
+
+    for( const auto& feature : plan.features_ )
+    {
+        switch( feature.kind_ )
+        {
+        case OBJECT_CONTAIN_SINGLE:
+        case OBJECT_CONTAIN_SINGLE_UNSETTABLE:
+        {
+            if( auto obj = anyObjectCast<std::shared_ptr<EObject>>( eObject->eGet( feature.eFeature_, false ) ) )
+                prepareFork( obj );
+            break;
+        }
+        case OBJECT_CONTAIN_MANY:
+        case OBJECT_CONTAIN_MANY_UNSETTABLE:
+        {
+            auto l = anyListCast<std::shared_ptr<EObject>>( eObject->eGet( feature.eFeature_, false ) );
+            for( const auto& obj : *l )
+                prepareFork( obj );
+            break;
+        }
+        case OBJECT_HREF_SINGLE:
+        case OBJECT_HREF_SINGLE_UNSETTABLE:
+        {
+            auto obj = anyObjectCast<std::shared_ptr<EObject>>( eObject->eGet( feature.eFeature_, false ) );
+            auto eResource = obj && !obj->eIsProxy() ? obj->eResource() : nullptr;
+            if( eResource )
+                getURIFragments( eResource );
+            break;
+        }
+        case OBJECT_HREF_MANY:
+        case OBJECT_HREF_MANY_UNSETTABLE:
+        {
+            auto l = anyListCast<std::shared_ptr<EObject>>( eObject->eGet( feature.eFeature_, false ) );
+            for( const auto& obj : *l )
+            {
+                auto eResource = !obj->eIsProxy() ? obj->eResource() : nullptr;
+                if( eResource )
+                    getURIFragments( eResource );
+            }
+            break;
+        }
+        default:
+            break;
+        }
+    }
+}
+
+void XMLSave::saveEObject( const std::shared_ptr<EObject>& eObject, const FeaturePlan& feature )
 {
     if (eObject->eIsProxy() || eObject->getInternal().eInternalResource() )
-        saveHRef(eObject, eFeature);
+        saveHRef(eObject, feature);
     else {
-        str_.startElement(getQName(eFeature));
+        str_.startElement(feature.qName_);
         auto eClass = eObject->eClass();
-        auto eType = eFeature->getEType();
-        if (eType != eClass && eType != EcorePackage::eInstance()->getEObject())
+        if (feature.eType_ != eClass && feature.eType_ != EcorePackage::eInstance()->getEObject())
         {
             saveTypeAttribute(eClass);
         }
@@ -348,55 +568,62 @@ void XMLSave::saveEObject( const std::shared_ptr<EObject>& eObject, const std::s
 void XMLSave::saveTypeAttribute( const std::shared_ptr<EClass>& eClass )
 {
     str_.addAttribute( "xsi:type", getQName( eClass ) );
+    addXSINamespace();
+}
+
+void XMLSave::addXSINamespace()
+{
+    if( isForked_ && prefixesToURI_.find( XSI_NS ) == prefixesToURI_.end() )
+        discoveries_.push_back( Discovery{ nullptr, false, XSI_NS } );
     uriToPrefixes_[XSI_URI] = {XSI_NS};
     prefixesToURI_[XSI_NS] = XSI_URI;
 }
 
-void XMLSave::saveHRefSingle( const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature )
+void XMLSave::saveHRefSingle( const std::shared_ptr<EObject>& eObject, const FeaturePlan& feature )
 {
-    auto value = eObject->eGet( eFeature , false );
+    auto value = eObject->eGet( feature.eFeature_ , false );
     auto o = anyObjectCast<std::shared_ptr<EObject>>( value );
     if( o )
-        saveHRef( o, eFeature );
+        saveHRef( o, feature );
 }
 
-void XMLSave::saveHRefMany( const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature )
+void XMLSave::saveHRefMany( const std::shared_ptr<EObject>& eObject, const FeaturePlan& feature )
 {
-    auto val = eObject->eGet( eFeature, false );
+    auto val = eObject->eGet( feature.eFeature_, false );
     auto l = anyListCast<std::shared_ptr<EObject>>( val );
     for( auto obj : *l )
-        saveHRef( obj, eFeature );
+        saveHRef( obj, feature );
 }
 
-void XMLSave::saveHRef( const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature )
+void XMLSave::saveHRef( const std::shared_ptr<EObject>& eObject, const FeaturePlan& feature )
 {
     auto href = getHRef( eObject );
     if( href.empty() )
         return;
-    str_.startElement( getQName( eFeature ) );
+    str_.startElement( feature.qName_ );
     auto eClass = eObject->eClass();
-    auto eType = std::dynamic_pointer_cast<EClass>( eFeature->getEType() );
+    const auto& eType = feature.eClassType_;
     if( eType != eClass && eType && eType->isAbstract() )
         saveTypeAttribute( eClass );
     str_.addAttribute( "href", href );
     str_.endEmptyElement();
 }
 
-void XMLSave::saveIDRefSingle( const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature )
+void XMLSave::saveIDRefSingle( const std::shared_ptr<EObject>& eObject, const FeaturePlan& feature )
 {
-    auto value = eObject->eGet( eFeature, false );
+    auto value = eObject->eGet( feature.eFeature_, false );
     auto obj = anyObjectCast<std::shared_ptr<EObject>>( value );
     if( obj )
     {
         auto id = getIDRef( obj );
         if( !id.empty() )
-            str_.addAttribute( getQName( eFeature ), id );
+            str_.addAttribute( feature.qName_, id );
     }
 }
 
-void XMLSave::saveIDRefMany( const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature )
+void XMLSave::saveIDRefMany( const std::shared_ptr<EObject>& eObject, const FeaturePlan& feature )
 {
-    auto val = eObject->eGet( eFeature, false );
+    auto val = eObject->eGet( feature.eFeature_, false );
     auto l = anyListCast<std::shared_ptr<EObject>>( val );
     auto failure = false;
     std::string s = "";
@@ -417,7 +644,7 @@ void XMLSave::saveIDRefMany( const std::shared_ptr<EObject>& eObject, const std:
         }
     }
     if( !failure && !s.empty() )
-        str_.addAttribute( getQName( eFeature ), s );
+        str_.addAttribute( feature.qName_, s );
 }
 
 bool XMLSave::isNil( const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature )
@@ -437,6 +664,33 @@ bool XMLSave::shouldSaveFeature( const std::shared_ptr<EObject>& eObject, const
     return eObject->eIsSet( eFeature ) || (keepDefaults_ && !eFeature->getDefaultValueLiteral().empty());
 }
 
+XMLSave::ClassPlan& XMLSave::getClassPlan( const std::shared_ptr<EClass>& eClass )
+{
+    auto [it, inserted] = classPlans_.try_emplace( eClass.get() );
+    auto& plan = it->second;
+    if( inserted )
+    {
+        auto eAllFeatures = eClass->getEAllStructuralFeatures();
+        plan.features_.reserve( eAllFeatures->size() );
+        for( const auto& eFeature : *eAllFeatures )
+        {
+            auto& feature = plan.features_.emplace_back();
+            feature.eFeature_ = eFeature;
+            feature.kind_ = getFeatureKind( eFeature );
+            feature.qName_ = getQName( eFeature );
+            feature.eType_ = eFeature->getEType();
+            feature.eClassType_ = std::dynamic_pointer_cast<EClass>( feature.eType_ );
+            feature.eDataType_ = std::dynamic_pointer_cast<EDataType>( feature.eType_ );
+            if( feature.eDataType_ )
+            {
+                feature.eFactory_ = feature.eDataType_->getEPackage()->getEFactoryInstance();
+                feature.primitiveKind_ = PrimitiveConverter::getKind( feature.eDataType_ );
+            }
+        }
+    }
+    return plan;
+}
+
 XMLSave::FeatureKind XMLSave::getFeatureKind( const std::shared_ptr<EStructuralFeature>& eFeature )
 {
     if( eFeature->isTransient() )
@@ -516,9 +770,13 @@ XMLSave::ResourceKind XMLSave::getResourceKindMany( const std::shared_ptr<EObjec
     return SAME;
 }
 
-std::string XMLSave::getQName( const std::shared_ptr<EClass>& eClass )
+const std::string& XMLSave::getQName( const std::shared_ptr<EClass>& eClass )
 {
-    return getQName( eClass->getEPackage(), eClass->getName(), false );
+    // the prefix of a class package is found the first time the class is written, as it would be without a plan
+    auto& plan = getClassPlan( eClass );
+    if( !plan.qName_ )
+        plan.qName_ = getQName( eClass->getEPackage(), eClass->getName(), false );
+    return *plan.qName_;
 }
 
 std::string XMLSave::getQName( const std::shared_ptr<EStructuralFeature>& eFeature )
@@ -540,7 +798,7 @@ std::string XMLSave::getQName( const std::shared_ptr<EPackage>& ePackage, const
 std::string XMLSave::getPrefix( const std::shared_ptr<EPackage>& ePackage, bool mustHavePrefix )
 {
     std::string nsPrefix;
-    auto itFound = packages_.find( ePackage );
+    auto itFound = packages_.find( ePackage.get() );
     if( itFound != packages_.end() )
         nsPrefix = itFound->second;
     else
@@ -577,25 +835,34 @@ std::string XMLSave::getPrefix( const std::shared_ptr<EPackage>& ePackage, bool
             }
             prefixesToURI_[nsPrefix] = nsURI;
         }
-        packages_[ePackage] = nsPrefix;
+        packages_[ePackage.get()] = nsPrefix;
+        if( isForked_ )
+            discoveries_.push_back( Discovery{ ePackage, mustHavePrefix, nsPrefix } );
     }
     return nsPrefix;
 }
 
-std::string XMLSave::getDataType( const Any& value, const std::shared_ptr<EStructuralFeature>& eFeature, bool isAttribute )
+std::string XMLSave::getDataType( const Any& value, const FeaturePlan& feature, bool isAttribute )
 {
     if( value.empty() )
         return "";
     else
     {
-        auto d = std::static_pointer_cast<EDataType>( eFeature->getEType() );
-        auto p = d->getEPackage();
-        auto f = p->getEFactoryInstance();
-        auto s = f->convertToString( d, value );
+        auto s = convertToString( feature, value );
+        if( statistics_ )
+            statistics_->attributeConverted();
         return s;
     }
 }
 
+std::string XMLSave::convertToString( const FeaturePlan& feature, const Any& value )
+{
+    std::string literal;
+    if( PrimitiveConverter::convertToString( feature.primitiveKind_, value, literal ) )
+        return literal;
+    return feature.eFactory_->convertToString( feature.eDataType_, value );
+}
+
 std::string XMLSave::getHRef( const std::shared_ptr<EObject>& eObject )
 {
     auto& internal = eObject->getInternal();
@@ -617,12 +884,33 @@ std::string XMLSave::getHRef( const std::shared_ptr<EObject>& eObject )
 std::string XMLSave::getHRef( const std::shared_ptr<EResource>& eResource, const std::shared_ptr<EObject>& eObject )
 {
     auto uri = eResource->getURI();
-    auto fragment = eResource->getURIFragment( eObject );
+    auto fragment = getURIFragment( eResource, eObject );
     uri.setFragment( fragment );
     return uri.toString();
 }
 
 std::string XMLSave::getIDRef( const std::shared_ptr<EObject>& eObject )
 {
-    return "#" + resource_.getURIFragment( eObject );
+    return "#" + getURIFragment( resource_.getThisPtr(), eObject );
+}
+
+std::string XMLSave::getURIFragment( const std::shared_ptr<EResource>& eResource, const std::shared_ptr<EObject>& eObject )
+{
+    // fragments of a resource are computed once per save, so that
+    // references to objects in large containment lists don't rescan them
+    const auto& fragments = getURIFragments( eResource );
+    auto itFragment = fragments.find( eObject.get() );
+    return itFragment != fragments.end() ? itFragment->second : eResource->getURIFragment( eObject );
+}
+
+const XMLSave::URIFragments& XMLSave::getURIFragments( const std::shared_ptr<EResource>& eResource )
+{
+    auto it = uriFragments_.find( eResource.get() );
+    if( it == uriFragments_.end() )
+    {
+        auto abstractResource = std::dynamic_pointer_cast<AbstractResource>( eResource );
+        auto fragments = abstractResource ? abstractResource->getURIFragments() : URIFragments();
+        it = uriFragments_.emplace( eResource.get(), std::make_shared<const URIFragments>( std::move( fragments ) ) ).first;
+    }
+    return *it->second;
 }
@@ -11,16 +11,28 @@
 #define ECORE_XMLSAVE_HPP_
 
 #include "ecore/Any.hpp"
+#include "ecore/impl/AbstractResource.hpp"
+#include "ecore/impl/PrimitiveConverter.hpp"
 #include "ecore/impl/XMLNamespaces.hpp"
 #include "ecore/impl/XMLString.hpp"
 
 #include <map>
+#include <optional>
+#include <unordered_map>
+#include <vector>
 
 namespace ecore {
+    template <typename T>
+    class EList;
+
     class EClass;
+    class EClassifier;
+    class EDataType;
+    class EFactory;
     class EObject;
     class EPackage;
     class EResource;
+    class EResourceStatistics;
     class EStructuralFeature;
 }
 
@@ -28,52 +40,22 @@ namespace ecore::impl
 {
     class EObjectInternal;
 
+    class ResourceStatistics;
+
     class XMLResource;
 
     class XMLSave
     {
     public:
-        XMLSave(XMLResource& resource);
+        XMLSave(XMLResource& resource, const EResource::Options& options);
 
         virtual ~XMLSave();
 
         void save(std::ostream& o);
 
-    protected:
-        void saveHeader();
-        std::shared_ptr<XMLString::Segment> saveTopObject(const std::shared_ptr<EObject>& eObject);
-        virtual void saveNamespaces();
-        void saveElementID(const std::shared_ptr<EObject>& eObject);
-        bool saveFeatures(const std::shared_ptr<EObject>& eObject, bool attributesOnly);
-
-        void saveDataTypeSingle(const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature);
-        void saveDataTypeMany(const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature);
-
-        void saveManyEmpty(const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature);
-
-        void saveEObjectSingle(const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature);
-        void saveEObjectMany(const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature);
-
-        void saveNil(const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature);
-
-        void saveContainedSingle(const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature);
-        void saveContainedMany(const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature);
-
-        void saveEObject(const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature);
-        void saveTypeAttribute(const std::shared_ptr<EClass>& eClass);
-
-        void saveHRefSingle(const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature);
-
-        void saveHRefMany(const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature);
-        void saveHRef(const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature);
-
-        void saveIDRefSingle(const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature);
-        void saveIDRefMany(const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature);
-
-        bool isNil(const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature);
-        bool isEmpty(const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature);
-        bool shouldSaveFeature(const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature);
+        void saveDelta(std::ostream& o, bool isContentsModified, const std::vector<AbstractResource::ModifiedObject>& modifiedObjects);
 
+    protected:
         enum FeatureKind {
             TRANSIENT,
             DATATYPE_SINGLE,
@@ -103,7 +85,74 @@ namespace ecore::impl
             OBJECT_ATTRIBUTE_IDREF_MANY,
             DATATYPE_ATTRIBUTE_MANY,
         };
-        
+
+        // what is written for a feature, computed once per save
+        struct FeaturePlan
+        {
+            std::shared_ptr<EStructuralFeature> eFeature_;
+            FeatureKind kind_;
+            std::string qName_;
+            std::shared_ptr<EClassifier> eType_;
+            std::shared_ptr<EClass> eClassType_;
+            std::shared_ptr<EDataType> eDataType_;
+            std::shared_ptr<EFactory> eFactory_;
+            PrimitiveConverter::Kind primitiveKind_ = PrimitiveConverter::Kind::NONE;
+        };
+
+        // features of a class indexed by feature ID, its qualified name is computed the first time it is written
+        struct ClassPlan
+        {
+            std::optional<std::string> qName_;
+            std::vector<FeaturePlan> features_;
+        };
+
+        // a save of subtrees continuing parent in str : its results are merged back with join
+        XMLSave(const XMLSave& parent, XMLString&& str);
+
+        bool join(XMLSave& fork);
+
+        void saveHeader();
+        void write(std::ostream& o);
+        std::shared_ptr<XMLString::Segment> saveTopObject(const std::shared_ptr<EObject>& eObject);
+        void saveModifiedObject(const std::shared_ptr<EObject>& eObject, bool isContentsModified);
+        virtual void saveNamespaces();
+        void saveElementID(const std::shared_ptr<EObject>& eObject);
+        bool saveFeatures(const std::shared_ptr<EObject>& eObject, bool attributesOnly);
+
+        void saveDataTypeSingle(const std::shared_ptr<EObject>& eObject, const FeaturePlan& feature);
+        void saveDataTypeMany(const std::shared_ptr<EObject>& eObject, const FeaturePlan& feature);
+
+        void saveManyEmpty(const std::shared_ptr<EObject>& eObject, const FeaturePlan& feature);
+
+        void saveEObjectSingle(const std::shared_ptr<EObject>& eObject, const FeaturePlan& feature);
+        void saveEObjectMany(const std::shared_ptr<EObject>& eObject, const FeaturePlan& feature);
+
+        void saveNil(const std::shared_ptr<EObject>& eObject, const FeaturePlan& feature);
+
+        void saveContainedSingle(const std::shared_ptr<EObject>& eObject, const FeaturePlan& feature);
+        void saveContainedMany(const std::shared_ptr<EObject>& eObject, const FeaturePlan& feature);
+        void prepareFork(const std::shared_ptr<EObject>& eObject);
+        void saveContainedManyParallel(const std::shared_ptr<EList<std::shared_ptr<EObject>>>& eObjects,
+                                       const FeaturePlan& feature,
+                                       std::size_t nbForks);
+
+        void saveEObject(const std::shared_ptr<EObject>& eObject, const FeaturePlan& feature);
+        void saveTypeAttribute(const std::shared_ptr<EClass>& eClass);
+        void addXSINamespace();
+
+        void saveHRefSingle(const std::shared_ptr<EObject>& eObject, const FeaturePlan& feature);
+
+        void saveHRefMany(const std::shared_ptr<EObject>& eObject, const FeaturePlan& feature);
+        void saveHRef(const std::shared_ptr<EObject>& eObject, const FeaturePlan& feature);
+
+        void saveIDRefSingle(const std::shared_ptr<EObject>& eObject, const FeaturePlan& feature);
+        void saveIDRefMany(const std::shared_ptr<EObject>& eObject, const FeaturePlan& feature);
+
+        bool isNil(const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature);
+        bool isEmpty(const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature);
+        bool shouldSaveFeature(const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature);
+
+        ClassPlan& getClassPlan(const std::shared_ptr<EClass>& eClass);
         FeatureKind getFeatureKind(const std::shared_ptr<EStructuralFeature>& eFeature);
 
         enum ResourceKind {
@@ -116,24 +165,45 @@ namespace ecore::impl
         ResourceKind getResourceKindMany( const std::shared_ptr<EObject>& eObject, const std::shared_ptr<EStructuralFeature>& eFeature );
 
 
-        std::string getQName(const std::shared_ptr<EClass>& eClass);
+        const std::string& getQName(const std::shared_ptr<EClass>& eClass);
         std::string getQName(const std::shared_ptr<EPackage>& ePackage , const std::string& name, bool mustHavePrefix);
         std::string getQName(const std::shared_ptr<EStructuralFeature>& eFeature);
         std::string getPrefix(const std::shared_ptr<EPackage>& ePackage, bool mustHavePrefix);
-        std::string getDataType(const Any& value, const std::shared_ptr<EStructuralFeature>& eFeature, bool isAttribute);
+        std::string getDataType(const Any& value, const FeaturePlan& feature, bool isAttribute);
+        std::string convertToString(const FeaturePlan& feature, const Any& value);
         std::string getHRef(const std::shared_ptr<EObject>& eObject);
         std::string getHRef(const std::shared_ptr<EResource>& eResource, const std::shared_ptr<EObject>& eObject);
         std::string getIDRef(const std::shared_ptr<EObject>& eObject);
+        std::string getURIFragment(const std::shared_ptr<EResource>& eResource, const std::shared_ptr<EObject>& eObject);
+
+        using URIFragments = std::unordered_map<EObject*, std::string>;
+        const URIFragments& getURIFragments(const std::shared_ptr<EResource>& eResource);
+
+        // namespace found by a fork, in the order of its save
+        struct Discovery
+        {
+            std::shared_ptr<EPackage> ePackage_; // null for the xsi namespace
+            bool mustHavePrefix_;
+            std::string prefix_;
+        };
 
     protected:
         XMLResource& resource_;
+        EResourceStatistics* statistics_;
         XMLNamespaces namespaces_;
         XMLString str_;
-        std::map<std::shared_ptr<EPackage>, std::string> packages_;
+        std::unordered_map<EPackage*, std::string> packages_;
         std::map<std::string, std::vector<std::string>> uriToPrefixes_;
         std::map<std::string, std::string> prefixesToURI_;
-        std::map<std::shared_ptr< EStructuralFeature>, FeatureKind> featureKinds_;
+        std::unordered_map<EClass*, ClassPlan> classPlans_;
+        std::vector<const FeaturePlan*> elementFeatures_;
+        std::unordered_map<EResource*, std::shared_ptr<const URIFragments>> uriFragments_;
         bool keepDefaults_;
+        bool isContainmentSaved_;
+        bool isParallel_;
+        bool isForked_;
+        std::vector<Discovery> discoveries_;
+        std::unique_ptr<ResourceStatistics> forkStatistics_;
     };
 }
 
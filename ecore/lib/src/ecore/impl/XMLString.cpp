@@ -15,6 +15,8 @@ XMLString::XMLString()
     : lineWidth_( std::numeric_limits<int>::max() )
     , depth_(0)
     , lastElementIsStart_(false)
+    , isStartForked_(false)
+    , isForkedStartClosed_(false)
     , currentSegment_( std::make_shared<Segment>() )
     , indentation_("    ")
     , indents_({""})
@@ -22,10 +24,15 @@ XMLString::XMLString()
     segments_ = { currentSegment_ };
 }
 
-void XMLString::write(std::ostream& os)
+std::size_t XMLString::write(std::ostream& os)
 {
+    std::size_t size = 0;
     for (auto s : segments_)
+    {
         os << s->buffer_;
+        size += s->buffer_.size();
+    }
+    return size;
 }
 
 void XMLString::add(const std::string& s)
@@ -62,6 +69,10 @@ void XMLString::closeStartElement()
     add(">");
     addLine();
     lastElementIsStart_ = false;
+    if (isStartForked_) {
+        isStartForked_ = false;
+        isForkedStartClosed_ = true;
+    }
 }
 
 void XMLString::endElement()
@@ -171,6 +182,37 @@ void XMLString::resetToMark(const std::shared_ptr<Segment>& m)
         currentSegment_ = m;
 }
 
+XMLString XMLString::fork() const
+{
+    XMLString s;
+    s.lineWidth_ = lineWidth_;
+    s.depth_ = depth_;
+    s.indentation_ = indentation_;
+    s.indents_ = indents_;
+    s.lastElementIsStart_ = lastElementIsStart_;
+    s.isStartForked_ = lastElementIsStart_;
+    s.currentSegment_->lineWidth_ = currentSegment_->lineWidth_;
+    return s;
+}
+
+void XMLString::join(const XMLString& s)
+{
+    // every fork closes the start element it was forked from when it writes its first element :
+    // only the first one is kept
+    const auto& buffer = s.currentSegment_->buffer_;
+    std::size_t offset = 0;
+    if (s.isForkedStartClosed_) {
+        if (lastElementIsStart_)
+            lastElementIsStart_ = false;
+        else
+            offset = 2; // ">\n"
+    }
+    if (offset < buffer.size()) {
+        currentSegment_->buffer_.append(buffer, offset, std::string::npos);
+        currentSegment_->lineWidth_ = s.currentSegment_->lineWidth_;
+    }
+}
+
 std::string XMLString::removeLast()
 {
     auto end = elementNames_.back();
@@ -24,7 +24,8 @@ namespace ecore::impl
     public:
         XMLString();
 
-        void write(std::ostream& os);
+        // returns the number of bytes written
+        std::size_t write(std::ostream& os);
 
         void add(const std::string& s);
         void addLine();
@@ -45,6 +46,11 @@ namespace ecore::impl
         std::shared_ptr<Segment> mark();
         void resetToMark(const std::shared_ptr<Segment>& m);
 
+        // returns an empty string continuing this one at its current element :
+        // its elements are written to this one by join, in the order of the forks
+        XMLString fork() const;
+        void join(const XMLString& s);
+
     private:
         std::string removeLast();
 
@@ -60,6 +66,8 @@ namespace ecore::impl
         std::string indentation_;
         std::vector<std::string> indents_;
         bool lastElementIsStart_;
+        bool isStartForked_;
+        bool isForkedStartClosed_;
         std::vector<std::string> elementNames_;
     };
 }
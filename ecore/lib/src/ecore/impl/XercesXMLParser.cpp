@@ -0,0 +1,150 @@
+#include "ecore/impl/XercesXMLParser.hpp"
+#include "ecore/impl/SaxParserPool.hpp"
+#include "ecore/impl/StringUtils.hpp"
+#include "ecore/impl/XMLInputSource.hpp"
+
+#include <memory>
+
+#include <xercesc/sax/Locator.hpp>
+#include <xercesc/sax/SAXParseException.hpp>
+#include <xercesc/sax2/Attributes.hpp>
+#include <xercesc/sax2/DefaultHandler.hpp>
+
+using namespace ecore;
+using namespace ecore::impl;
+using namespace xercesc;
+
+namespace
+{
+    class XercesLocator : public XMLLocator
+    {
+    public:
+        XercesLocator( const Locator* locator )
+            : locator_( locator )
+        {
+        }
+
+        virtual std::string getSystemId() const
+        {
+            auto systemId = locator_->getSystemId();
+            return systemId ? utf16_to_utf8( systemId ) : std::string();
+        }
+
+        virtual int getLineNumber() const
+        {
+            return static_cast<int>( locator_->getLineNumber() );
+        }
+
+        virtual int getColumnNumber() const
+        {
+            return static_cast<int>( locator_->getColumnNumber() );
+        }
+
+    private:
+        const Locator* locator_;
+    };
+
+    // forwards the events of xerces in utf-8 : names are converted in buffers reused from an element to the other
+    class XercesHandler : public DefaultHandler
+    {
+    public:
+        XercesHandler( XMLHandler& handler )
+            : handler_( handler )
+        {
+        }
+
+        virtual void setDocumentLocator( const Locator* const locator )
+        {
+            locator_ = std::make_unique<XercesLocator>( locator );
+            handler_.setDocumentLocator( locator_.get() );
+        }
+
+        virtual void startDocument()
+        {
+            handler_.startDocument();
+        }
+
+        virtual void endDocument()
+        {
+            handler_.endDocument();
+        }
+
+        virtual void startElement( const XMLCh* const uri,
+                                   const XMLCh* const localname,
+                                   const XMLCh* const qname,
+                                   const Attributes& attrs )
+        {
+            attributes_.clear();
+            for( XMLSize_t i = 0; i < attrs.getLength(); ++i )
+            {
+                auto& attribute = attributes_.add();
+                utf16_to_utf8( attrs.getQName( i ), attribute.qName_ );
+                utf16_to_utf8( attrs.getURI( i ), attribute.uri_ );
+                utf16_to_utf8( attrs.getLocalName( i ), attribute.localName_ );
+                utf16_to_utf8( attrs.getValue( i ), attribute.value_ );
+            }
+            utf16_to_utf8( uri, uri_ );
+            utf16_to_utf8( localname, localName_ );
+            utf16_to_utf8( qname, qName_ );
+            handler_.startElement( uri_, localName_, qName_, attributes_ );
+        }
+
+        virtual void endElement( const XMLCh* const uri, const XMLCh* const localname, const XMLCh* const qname )
+        {
+            utf16_to_utf8( uri, uri_ );
+            utf16_to_utf8( localname, localName_ );
+            utf16_to_utf8( qname, qName_ );
+            handler_.endElement( uri_, localName_, qName_ );
+        }
+
+        virtual void startPrefixMapping( const XMLCh* const prefix, const XMLCh* const uri )
+        {
+            utf16_to_utf8( prefix, localName_ );
+            utf16_to_utf8( uri, uri_ );
+            handler_.startPrefixMapping( localName_, uri_ );
+        }
+
+        virtual void error( const SAXParseException& exc )
+        {
+            handler_.error(
+                utf16_to_utf8( exc.getMessage() ), static_cast<int>( exc.getLineNumber() ), static_cast<int>( exc.getColumnNumber() ) );
+        }
+
+        virtual void fatalError( const SAXParseException& exc )
+        {
+            handler_.error(
+                utf16_to_utf8( exc.getMessage() ), static_cast<int>( exc.getLineNumber() ), static_cast<int>( exc.getColumnNumber() ) );
+        }
+
+        virtual void warning( const SAXParseException& exc )
+        {
+            handler_.warning(
+                utf16_to_utf8( exc.getMessage() ), static_cast<int>( exc.getLineNumber() ), static_cast<int>( exc.getColumnNumber() ) );
+        }
+
+    private:
+        XMLHandler& handler_;
+        std::unique_ptr<XercesLocator> locator_;
+        XMLAttributes attributes_;
+        std::string uri_;
+        std::string localName_;
+        std::string qName_;
+    };
+
+} // namespace
+
+void XercesXMLParser::parse( std::istream& is, XMLHandler& handler, EResourceStatistics* statistics )
+{
+    XercesHandler xercesHandler( handler );
+    auto& pool = SaxParserPool::getInstance();
+    auto parser = pool.getParser();
+    auto& reader = parser->getReader();
+    reader.setContentHandler( &xercesHandler );
+
+    XMLInputSource source( is );
+    source.setStatistics( statistics );
+    reader.parse( source );
+
+    // readers of the pool outlive the handler
+    reader.setContentHandler( nullptr );
+}
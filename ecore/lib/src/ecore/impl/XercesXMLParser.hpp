@@ -0,0 +1,31 @@
+// *****************************************************************************
+//
+// This file is part of a MASA library or program.
+// Refer to the included end-user license agreement for restrictions.
+//
+// Copyright (c) 2020 MASA Group
+//
+// *****************************************************************************
+
+#ifndef ECORE_XERCESXMLPARSER_HPP_
+#define ECORE_XERCESXMLPARSER_HPP_
+
+#include "ecore/Exports.hpp"
+#include "ecore/impl/XMLHandler.hpp"
+
+namespace ecore::impl
+{
+    // Parses with a reader of the SaxParserPool : its utf-16 events are converted to utf-8.
+    class ECORE_API XercesXMLParser : public XMLParser
+    {
+    public:
+        XercesXMLParser() = default;
+
+        virtual ~XercesXMLParser() = default;
+
+        virtual void parse( std::istream& is, XMLHandler& handler, EResourceStatistics* statistics );
+    };
+
+} // namespace ecore::impl
+
+#endif
@@ -233,6 +233,14 @@ BOOST_AUTO_TEST_CASE( Unique_AddAll_Index )
     }
 }
 
+BOOST_AUTO_TEST_CASE( Unique_AddAllUnique_Index )
+{
+    BasicEList<int, true> list = {1, 2};
+    ImmutableArrayEList<int> other = {3, 4};
+    BOOST_CHECK( list.addAllUnique( 1, other ) );
+    BOOST_CHECK_EQUAL( list, std::vector<int>( {1, 3, 4, 2} ) );
+}
+
 #ifdef _DEBUG
 BOOST_AUTO_TEST_CASE( Remove_InvalidIndex, *boost::unit_test::precondition( no_debugger() ) )
 {
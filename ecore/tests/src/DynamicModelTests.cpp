@@ -14,6 +14,10 @@
 #include "ecore/EcoreUtils.hpp"
 #include "ecore/Stream.hpp"
 #include "ecore/impl/AbstractResource.hpp"
+#include "ecore/impl/ResourceIDManager.hpp"
+#include "ecore/impl/ResourceTypeIndex.hpp"
+
+#include <algorithm>
 
 using namespace ecore;
 using namespace ecore::impl;
@@ -168,11 +172,11 @@ namespace
         }
 
     private:
-        virtual void doLoad( std::istream& is ) override
+        virtual void doLoad( std::istream& is, const Options& options ) override
         {
         }
 
-        virtual void doSave( std::ostream& os ) override
+        virtual void doSave( std::ostream& os, const Options& options ) override
         {
         }
     };
@@ -223,4 +227,77 @@ BOOST_FIXTURE_TEST_CASE( getURI_Resource, BookStoreInstanciateModel )
     BOOST_CHECK_EQUAL( EcoreUtils::getURI( bookObject ), URI( "file://a.test#//@books.0" ) );
 }
 
+BOOST_FIXTURE_TEST_CASE( getEObject_IDManager, BookStoreInstanciateModel )
+{
+    bookName->setID( true );
+
+    auto resource = std::make_shared<Resource>( URI( "file://a.test" ) );
+    resource->setThisPtr( resource );
+    resource->setIDManager( std::make_shared<ResourceIDManager>() );
+
+    auto contents = resource->getContents();
+    contents->add( bookStoreObject );
+    BOOST_CHECK_EQUAL( resource->getEObject( "Harry Potter and the Deathly Hallows" ), bookObject );
+
+    // id attribute changes
+    bookObject->eSet( bookName, std::string( "Dune" ) );
+    BOOST_CHECK_EQUAL( resource->getEObject( "Harry Potter and the Deathly Hallows" ), nullptr );
+    BOOST_CHECK_EQUAL( resource->getEObject( "Dune" ), bookObject );
+
+    bookObject->eUnset( bookName );
+    BOOST_CHECK_EQUAL( resource->getEObject( "Dune" ), nullptr );
+
+    // containment changes
+    auto otherBookObject = bookStoreEPackage->getEFactoryInstance()->create( bookEClass );
+    otherBookObject->eSet( bookName, std::string( "Ulysses" ) );
+    auto allBooks = anyListCast<std::shared_ptr<EObject>>( bookStoreObject->eGet( bookStore_Books ) );
+    allBooks->add( otherBookObject );
+    BOOST_CHECK_EQUAL( resource->getEObject( "Ulysses" ), otherBookObject );
+
+    allBooks->remove( otherBookObject );
+    BOOST_CHECK_EQUAL( resource->getEObject( "Ulysses" ), nullptr );
+}
+
+BOOST_FIXTURE_TEST_CASE( getInstances_TypeIndex, BookStoreInstanciateModel )
+{
+    auto typeIndex = std::make_shared<ResourceTypeIndex>();
+    auto resource = std::make_shared<Resource>( URI( "file://a.test" ) );
+    resource->setThisPtr( resource );
+    resource->setTypeIndex( typeIndex );
+
+    auto contents = resource->getContents();
+    contents->add( bookStoreObject );
+    BOOST_CHECK( typeIndex->getInstances( bookStoreEClass ) == std::vector<std::shared_ptr<EObject>>{ bookStoreObject } );
+    BOOST_CHECK( typeIndex->getInstances( bookEClass ) == std::vector<std::shared_ptr<EObject>>{ bookObject } );
+
+    // instances of sub classes are returned with the instances of the class
+    auto novelEClass = EcoreFactory::eInstance()->createEClass();
+    novelEClass->setName( "Novel" );
+    novelEClass->getESuperTypes()->add( bookEClass );
+    bookStoreEPackage->getEClassifiers()->add( novelEClass );
+
+    auto novelObject = bookStoreEPackage->getEFactoryInstance()->create( novelEClass );
+    auto allBooks = anyListCast<std::shared_ptr<EObject>>( bookStoreObject->eGet( bookStore_Books ) );
+    allBooks->add( novelObject );
+    BOOST_CHECK( typeIndex->getInstances( novelEClass ) == std::vector<std::shared_ptr<EObject>>{ novelObject } );
+    auto books = typeIndex->getInstances( bookEClass );
+    BOOST_CHECK_EQUAL( books.size(), 2 );
+    BOOST_CHECK( std::find( books.begin(), books.end(), novelObject ) != books.end() );
+    BOOST_CHECK( std::find( books.begin(), books.end(), bookObject ) != books.end() );
+
+    // the sub classes follow the changes of the super types
+    novelEClass->getESuperTypes()->remove( bookEClass );
+    BOOST_CHECK( typeIndex->getInstances( bookEClass ) == std::vector<std::shared_ptr<EObject>>{ bookObject } );
+    novelEClass->getESuperTypes()->add( bookEClass );
+    BOOST_CHECK_EQUAL( typeIndex->getInstances( bookEClass ).size(), 2 );
+
+    // removed objects are no more instances
+    allBooks->remove( bookObject );
+    BOOST_CHECK( typeIndex->getInstances( bookEClass ) == std::vector<std::shared_ptr<EObject>>{ novelObject } );
+
+    contents->remove( bookStoreObject );
+    BOOST_CHECK( typeIndex->getInstances( bookStoreEClass ).empty() );
+    BOOST_CHECK( typeIndex->getInstances( bookEClass ).empty() );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -8,6 +8,7 @@
 #include "ecore/EcoreFactory.hpp"
 #include "ecore/EcorePackage.hpp"
 #include "ecore/Stream.hpp"
+#include "ecore/ext/EClassInternal.hpp"
 
 using namespace ecore;
 
@@ -52,6 +53,51 @@ BOOST_AUTO_TEST_CASE( SuperClass )
     eClass->getESuperTypes()->add( eSuperClass );
 }
 
+BOOST_AUTO_TEST_CASE( IsSuperTypeOf )
+{
+    auto eClass = EcoreFactory::eInstance()->createEClass();
+    auto eSuperClass = EcoreFactory::eInstance()->createEClass();
+    auto eSuperSuperClass = EcoreFactory::eInstance()->createEClass();
+    auto eOtherClass = EcoreFactory::eInstance()->createEClass();
+    eClass->getESuperTypes()->add( eSuperClass );
+    eSuperClass->getESuperTypes()->add( eSuperSuperClass );
+
+    BOOST_CHECK( eClass->isSuperTypeOf( eClass ) );
+    BOOST_CHECK( eSuperClass->isSuperTypeOf( eClass ) );
+    BOOST_CHECK( eSuperSuperClass->isSuperTypeOf( eClass ) );
+    BOOST_CHECK( !eClass->isSuperTypeOf( eSuperClass ) );
+    BOOST_CHECK( !eOtherClass->isSuperTypeOf( eClass ) );
+
+    // super types of the sub classes are updated
+    eSuperClass->getESuperTypes()->add( eOtherClass );
+    BOOST_CHECK( eOtherClass->isSuperTypeOf( eClass ) );
+
+    eSuperClass->getESuperTypes()->remove( eSuperSuperClass );
+    BOOST_CHECK( !eSuperSuperClass->isSuperTypeOf( eClass ) );
+    BOOST_CHECK( !eSuperSuperClass->isSuperTypeOf( eSuperClass ) );
+    BOOST_CHECK( eOtherClass->isSuperTypeOf( eClass ) );
+}
+
+BOOST_AUTO_TEST_CASE( IsSuperTypeOf_ClassIDReused )
+{
+    auto getClassID = []( const std::shared_ptr<EClass>& eClass ) {
+        return static_cast<ext::EClassInternal&>( eClass->getInternal() ).getClassID();
+    };
+    auto eClass = EcoreFactory::eInstance()->createEClass();
+    auto eSuperClass = EcoreFactory::eInstance()->createEClass();
+    eClass->getESuperTypes()->add( eSuperClass );
+    BOOST_CHECK( eSuperClass->isSuperTypeOf( eClass ) );
+
+    // the id of a destroyed class is reused by the next one
+    auto eOtherClass = EcoreFactory::eInstance()->createEClass();
+    auto otherClassID = getClassID( eOtherClass );
+    eOtherClass.reset();
+    auto eNewClass = EcoreFactory::eInstance()->createEClass();
+    BOOST_CHECK( getClassID( eNewClass ) <= otherClassID );
+    BOOST_CHECK( !eNewClass->isSuperTypeOf( eClass ) );
+    BOOST_CHECK( eSuperClass->isSuperTypeOf( eClass ) );
+}
+
 BOOST_AUTO_TEST_CASE( StructuralFeatures_Add )
 {
     auto eClass = EcoreFactory::eInstance()->createEClass();
@@ -0,0 +1,200 @@
+#include <boost/test/unit_test.hpp>
+
+#include "ecore/impl/NativeXMLParser.hpp"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace ecore;
+using namespace ecore::impl;
+
+namespace
+{
+    // records the events of a parsed document
+    class RecordingHandler : public XMLHandler
+    {
+    public:
+        struct Element
+        {
+            std::string uri_;
+            std::string localName_;
+            std::string qName_;
+            std::vector<XMLAttributes::Attribute> attributes_;
+        };
+
+        virtual void setDocumentLocator( const XMLLocator* locator )
+        {
+        }
+
+        virtual void startDocument()
+        {
+        }
+
+        virtual void endDocument()
+        {
+        }
+
+        virtual void startPrefixMapping( const std::string& prefix, const std::string& uri )
+        {
+        }
+
+        virtual void startElement( const std::string& uri,
+                                   const std::string& localName,
+                                   const std::string& qName,
+                                   const XMLAttributes& attributes )
+        {
+            auto& element = elements_.emplace_back( Element{uri, localName, qName, {}} );
+            for( std::size_t i = 0; i < attributes.getLength(); ++i )
+                element.attributes_.push_back(
+                    {attributes.getQName( i ), attributes.getURI( i ), attributes.getLocalName( i ), attributes.getValue( i )} );
+        }
+
+        virtual void endElement( const std::string& uri, const std::string& localName, const std::string& qName )
+        {
+        }
+
+        virtual void error( const std::string& message, int line, int column )
+        {
+            errors_.push_back( message );
+        }
+
+        virtual void warning( const std::string& message, int line, int column )
+        {
+        }
+
+        std::vector<Element> elements_;
+        std::vector<std::string> errors_;
+    };
+
+    RecordingHandler parse( const std::string& document )
+    {
+        std::istringstream is( document );
+        RecordingHandler handler;
+        NativeXMLParser parser;
+        parser.parse( is, handler, nullptr );
+        return handler;
+    }
+
+    bool isError( const RecordingHandler& handler, const std::string& message )
+    {
+        return handler.errors_.size() == 1 && handler.errors_[0].find( message ) != std::string::npos;
+    }
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE( NativeXMLParserTests )
+
+BOOST_AUTO_TEST_CASE( References )
+{
+    auto handler = parse( "<a v=\"&lt;&gt;&amp;&quot;&apos;&#65;&#x42;&#x263a;&#128512;\"/>" );
+    BOOST_REQUIRE( handler.errors_.empty() );
+    BOOST_REQUIRE_EQUAL( handler.elements_.size(), 1 );
+    BOOST_REQUIRE_EQUAL( handler.elements_[0].attributes_.size(), 1 );
+    BOOST_CHECK_EQUAL( handler.elements_[0].attributes_[0].value_, "<>&\"'AB\xE2\x98\xBA\xF0\x9F\x98\x80" );
+}
+
+BOOST_AUTO_TEST_CASE( References_Invalid )
+{
+    BOOST_CHECK( isError( parse( "<a v=\"&foo;\"/>" ), "Invalid reference in value of attribute 'v'" ) );
+    BOOST_CHECK( isError( parse( "<a v=\"&#;\"/>" ), "Invalid reference" ) );
+    BOOST_CHECK( isError( parse( "<a v=\"&#x1G;\"/>" ), "Invalid reference" ) );
+    BOOST_CHECK( isError( parse( "<a v=\"&#x110000;\"/>" ), "Invalid reference" ) );
+    BOOST_CHECK( isError( parse( "<a v=\"&amp\"/>" ), "Invalid reference" ) );
+}
+
+BOOST_AUTO_TEST_CASE( References_InvalidCharacters )
+{
+    BOOST_CHECK( isError( parse( "<a v=\"&#0;\"/>" ), "Invalid reference" ) );
+    BOOST_CHECK( isError( parse( "<a v=\"&#x1;\"/>" ), "Invalid reference" ) );
+    BOOST_CHECK( isError( parse( "<a v=\"&#xD800;\"/>" ), "Invalid reference" ) );
+    BOOST_CHECK( isError( parse( "<a v=\"&#57343;\"/>" ), "Invalid reference" ) );
+    BOOST_CHECK( isError( parse( "<a v=\"&#xFFFE;\"/>" ), "Invalid reference" ) );
+}
+
+BOOST_AUTO_TEST_CASE( Namespaces )
+{
+    auto handler = parse( "<a xmlns=\"urn:d\" xmlns:p=\"urn:p\" x=\"1\" p:y=\"2\"><p:b/><c xmlns=\"\"/></a>" );
+    BOOST_REQUIRE( handler.errors_.empty() );
+    BOOST_REQUIRE_EQUAL( handler.elements_.size(), 3 );
+
+    const auto& a = handler.elements_[0];
+    BOOST_CHECK_EQUAL( a.uri_, "urn:d" );
+    BOOST_CHECK_EQUAL( a.localName_, "a" );
+    // namespace declarations are not attributes, and the default namespace doesn't apply to attributes
+    BOOST_REQUIRE_EQUAL( a.attributes_.size(), 2 );
+    BOOST_CHECK_EQUAL( a.attributes_[0].uri_, "" );
+    BOOST_CHECK_EQUAL( a.attributes_[0].localName_, "x" );
+    BOOST_CHECK_EQUAL( a.attributes_[1].uri_, "urn:p" );
+    BOOST_CHECK_EQUAL( a.attributes_[1].localName_, "y" );
+    BOOST_CHECK_EQUAL( a.attributes_[1].qName_, "p:y" );
+
+    BOOST_CHECK_EQUAL( handler.elements_[1].uri_, "urn:p" );
+    BOOST_CHECK_EQUAL( handler.elements_[1].localName_, "b" );
+    BOOST_CHECK_EQUAL( handler.elements_[2].uri_, "" );
+    BOOST_CHECK_EQUAL( handler.elements_[2].localName_, "c" );
+}
+
+BOOST_AUTO_TEST_CASE( Namespaces_Unbound )
+{
+    BOOST_CHECK( isError( parse( "<p:a/>" ), "The prefix 'p' is not bound" ) );
+    BOOST_CHECK( isError( parse( "<a p:x=\"1\"/>" ), "The prefix 'p' is not bound" ) );
+    // the scope of a prefix is the element which declares it
+    BOOST_CHECK( isError( parse( "<a><b xmlns:p=\"urn:p\"/><p:c/></a>" ), "The prefix 'p' is not bound" ) );
+}
+
+BOOST_AUTO_TEST_CASE( Attributes_Normalization )
+{
+    auto handler = parse( "<a v=\"1\t2\n3\r\n4\r5&#10;6\"/>" );
+    BOOST_REQUIRE( handler.errors_.empty() );
+    BOOST_REQUIRE_EQUAL( handler.elements_.size(), 1 );
+    // referenced spaces are kept
+    BOOST_CHECK_EQUAL( handler.elements_[0].attributes_[0].value_, "1 2 3 4 5\n6" );
+}
+
+BOOST_AUTO_TEST_CASE( Attributes_Duplicate )
+{
+    BOOST_CHECK( isError( parse( "<a x=\"1\" x=\"2\"/>" ), "Attribute 'x' is already specified in element 'a'" ) );
+    BOOST_CHECK( isError( parse( "<a xmlns:p=\"urn:p\" xmlns:p=\"urn:q\"/>" ), "Attribute 'xmlns:p' is already specified" ) );
+    BOOST_CHECK( isError( parse( "<a xmlns:p=\"urn:p\" xmlns:q=\"urn:p\" p:x=\"1\" q:x=\"2\"/>" ),
+                          "Attribute 'q:x' is already specified" ) );
+}
+
+BOOST_AUTO_TEST_CASE( Encoding )
+{
+    auto handler = parse( "\xEF\xBB\xBF<?xml version=\"1.0\" encoding=\"UTF-8\"?><a/>" );
+    BOOST_CHECK( handler.errors_.empty() );
+    BOOST_CHECK_EQUAL( handler.elements_.size(), 1 );
+
+    handler = parse( "\xEF\xBB\xBF<a/>" );
+    BOOST_CHECK( handler.errors_.empty() );
+    BOOST_CHECK_EQUAL( handler.elements_.size(), 1 );
+}
+
+BOOST_AUTO_TEST_CASE( Encoding_Unsupported )
+{
+    BOOST_CHECK( isError( parse( "<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?><a/>" ), "Unsupported encoding" ) );
+    BOOST_CHECK( isError( parse( std::string( "\xFF\xFE<\0a\0/\0>\0", 10 ) ), "Unsupported encoding" ) );
+}
+
+BOOST_AUTO_TEST_CASE( Prolog_Skipped )
+{
+    auto handler = parse( "<?xml version=\"1.0\"?>\n"
+                          "<!DOCTYPE a [<!ELEMENT a ANY>]>\n"
+                          "<!-- comment -->\n"
+                          "<?pi data?>\n"
+                          "<a><!-- <b/> --><?pi <b/>?></a>\n"
+                          "<!-- after -->\n" );
+    BOOST_CHECK( handler.errors_.empty() );
+    BOOST_REQUIRE_EQUAL( handler.elements_.size(), 1 );
+    BOOST_CHECK_EQUAL( handler.elements_[0].localName_, "a" );
+}
+
+BOOST_AUTO_TEST_CASE( RootElement )
+{
+    BOOST_CHECK( isError( parse( "<a/><b/>" ), "Only one root element is allowed" ) );
+    BOOST_CHECK( isError( parse( "<!-- comment -->" ), "The document has no root element" ) );
+    BOOST_CHECK( isError( parse( "<a/>text" ), "Content is not allowed outside of the root element" ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
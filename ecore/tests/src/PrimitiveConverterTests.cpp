@@ -0,0 +1,94 @@
+#include <boost/test/unit_test.hpp>
+
+#include "ecore/EDataType.hpp"
+#include "ecore/EcoreFactory.hpp"
+#include "ecore/EcorePackage.hpp"
+#include "ecore/impl/PrimitiveConverter.hpp"
+
+#include <ctime>
+#include <utility>
+#include <vector>
+
+using namespace ecore;
+using namespace ecore::impl;
+
+namespace
+{
+    std::string convertWithFactory( const std::shared_ptr<EDataType>& eDataType, const Any& value )
+    {
+        return EcoreFactory::eInstance()->convertToString( eDataType, value );
+    }
+
+    std::string convertWithConverter( const std::shared_ptr<EDataType>& eDataType, const Any& value )
+    {
+        std::string literal;
+        BOOST_CHECK( PrimitiveConverter::convertToString( PrimitiveConverter::getKind( eDataType ), value, literal ) );
+        return literal;
+    }
+
+    template <typename T>
+    void checkCreate( const std::shared_ptr<EDataType>& eDataType, const std::string& literal )
+    {
+        Any value;
+        BOOST_CHECK( PrimitiveConverter::createFromString( PrimitiveConverter::getKind( eDataType ), literal, value ) );
+        BOOST_CHECK_EQUAL( anyCast<T>( value ), anyCast<T>( EcoreFactory::eInstance()->createFromString( eDataType, literal ) ) );
+    }
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE( PrimitiveConverterTests )
+
+BOOST_AUTO_TEST_CASE( Kind )
+{
+    auto ecorePackage = EcorePackage::eInstance();
+    BOOST_CHECK( PrimitiveConverter::getKind( ecorePackage->getEInt() ) == PrimitiveConverter::Kind::INT );
+    BOOST_CHECK( PrimitiveConverter::getKind( ecorePackage->getEDate() ) == PrimitiveConverter::Kind::DATE );
+    BOOST_CHECK( PrimitiveConverter::getKind( ecorePackage->getEString() ) == PrimitiveConverter::Kind::STRING );
+    BOOST_CHECK( PrimitiveConverter::getKind( EcoreFactory::eInstance()->createEDataType() ) == PrimitiveConverter::Kind::NONE );
+}
+
+BOOST_AUTO_TEST_CASE( CreateFromString )
+{
+    auto ecorePackage = EcorePackage::eInstance();
+    checkCreate<bool>( ecorePackage->getEBoolean(), "true" );
+    checkCreate<bool>( ecorePackage->getEBoolean(), "false" );
+    checkCreate<char>( ecorePackage->getEChar(), "c" );
+    checkCreate<std::time_t>( ecorePackage->getEDate(), "1974-06-20T05:22:10.000Z" );
+    checkCreate<double>( ecorePackage->getEDouble(), "-3.25" );
+    checkCreate<float>( ecorePackage->getEFloat(), "1.5" );
+    checkCreate<int>( ecorePackage->getEInt(), "-42" );
+    checkCreate<long>( ecorePackage->getELong(), "1234567" );
+    checkCreate<short>( ecorePackage->getEShort(), "12" );
+    checkCreate<std::string>( ecorePackage->getEString(), "a string" );
+}
+
+BOOST_AUTO_TEST_CASE( CreateFromString_Fallback )
+{
+    // literals the factory parses differently are left to it
+    Any value;
+    BOOST_CHECK( !PrimitiveConverter::createFromString( PrimitiveConverter::Kind::INT, " 42", value ) );
+    BOOST_CHECK( !PrimitiveConverter::createFromString( PrimitiveConverter::Kind::INT, "42abc", value ) );
+    BOOST_CHECK( !PrimitiveConverter::createFromString( PrimitiveConverter::Kind::SHORT, "100000", value ) );
+    BOOST_CHECK( !PrimitiveConverter::createFromString( PrimitiveConverter::Kind::DATE, "1974-06-20T05:22:10.500Z", value ) );
+    BOOST_CHECK( !PrimitiveConverter::createFromString( PrimitiveConverter::Kind::NONE, "42", value ) );
+    BOOST_CHECK( value.empty() );
+}
+
+BOOST_AUTO_TEST_CASE( ConvertToString )
+{
+    auto ecorePackage = EcorePackage::eInstance();
+    std::tm tm = { 10, 22, 5, 20, 5, 74, 0, 0, 0 };
+    auto t = std::mktime( &tm );
+    for( auto [eDataType, value] : std::vector<std::pair<std::shared_ptr<EDataType>, Any>>{ { ecorePackage->getEBoolean(), true },
+                                                                                           { ecorePackage->getEChar(), 'c' },
+                                                                                           { ecorePackage->getEDate(), t },
+                                                                                           { ecorePackage->getEDouble(), -3.25 },
+                                                                                           { ecorePackage->getEFloat(), 1.1f },
+                                                                                           { ecorePackage->getEInt(), -42 },
+                                                                                           { ecorePackage->getELong(), 1234567L },
+                                                                                           { ecorePackage->getEShort(), short( 12 ) },
+                                                                                           { ecorePackage->getEString(), std::string( "a string" ) } } )
+        BOOST_CHECK_EQUAL( convertWithConverter( eDataType, value ), convertWithFactory( eDataType, value ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -6,6 +6,7 @@
 #include "ecore/tests/MockEClass.hpp"
 #include "ecore/tests/MockEDataType.hpp"
 #include "ecore/tests/MockEFactory.hpp"
+#include "ecore/tests/MockEList.hpp"
 #include "ecore/tests/MockEObject.hpp"
 #include "ecore/tests/MockEPackage.hpp"
 
@@ -15,12 +16,13 @@ using namespace ecore::tests;
 
 namespace
 {
-    std::shared_ptr<MockEObject> createMockEObject( const std::string& id )
+    std::shared_ptr<MockEObject> createMockEObject( const std::string& id, MockEList<EAdapter*>& mockAdapters )
     {
         auto mockObject = std::make_shared<MockEObject>();
         auto mockClass = std::make_shared<MockEClass>();
         auto mockAttribute = std::make_shared<MockEAttribute>();
 
+        MOCK_EXPECT( mockObject->eAdapters ).returns( mockAdapters );
         MOCK_EXPECT( mockObject->eClass ).returns( mockClass );
         MOCK_EXPECT( mockClass->getEIDAttribute ).returns( mockAttribute );
         if( id.empty() )
@@ -41,17 +43,30 @@ namespace
         }
         return mockObject;
     }
+
+    std::shared_ptr<MockEObject> createMockEObjectWithoutIDAttribute()
+    {
+        auto mockObject = std::make_shared<MockEObject>();
+        auto mockClass = std::make_shared<MockEClass>();
+        MOCK_EXPECT( mockObject->eClass ).returns( mockClass );
+        MOCK_EXPECT( mockClass->getEIDAttribute ).returns( std::shared_ptr<EAttribute>() );
+        return mockObject;
+    }
 } // namespace
 
 BOOST_AUTO_TEST_SUITE( ResourceIDManagerTests )
 
 BOOST_AUTO_TEST_CASE( RegisterNoID )
 {
+    auto mockAdapters = std::make_shared<MockEList<EAdapter*>>();
+    MOCK_EXPECT( mockAdapters->add ).exactly( 3 ).returns( true );
+    MOCK_EXPECT( mockAdapters->removeObject ).exactly( 3 ).returns( true );
+
     auto m = std::make_unique<ResourceIDManager>();
 
-    auto mockObject = createMockEObject( "" );
-    auto mockChild1 = createMockEObject( "" );
-    auto mockChild2 = createMockEObject( "" );
+    auto mockObject = createMockEObject( "", *mockAdapters );
+    auto mockChild1 = createMockEObject( "", *mockAdapters );
+    auto mockChild2 = createMockEObject( "", *mockAdapters );
     auto mockChildren = std::make_shared<ImmutableArrayEList<std::shared_ptr<EObject>>>(
         std::initializer_list<std::shared_ptr<EObject>>{mockChild1, mockChild2} );
     auto emptyList = std::make_shared<ImmutableArrayEList<std::shared_ptr<EObject>>>();
@@ -66,13 +81,44 @@ BOOST_AUTO_TEST_CASE( RegisterNoID )
     BOOST_CHECK_EQUAL( m->getID( mockChild2 ), "" );
 }
 
+BOOST_AUTO_TEST_CASE( RegisterNoIDAttribute )
+{
+    auto mockAdapters = std::make_shared<MockEList<EAdapter*>>();
+    MOCK_EXPECT( mockAdapters->add ).exactly( 1 ).returns( true );
+    MOCK_EXPECT( mockAdapters->removeObject ).exactly( 1 ).returns( true );
+
+    auto m = std::make_unique<ResourceIDManager>();
+
+    // objects without id attribute are not adapted but their contents are registered
+    auto mockObject = createMockEObjectWithoutIDAttribute();
+    auto mockChild = createMockEObject( "id", *mockAdapters );
+    auto mockChildren = std::make_shared<ImmutableArrayEList<std::shared_ptr<EObject>>>(
+        std::initializer_list<std::shared_ptr<EObject>>{mockChild} );
+    auto emptyList = std::make_shared<ImmutableArrayEList<std::shared_ptr<EObject>>>();
+    MOCK_EXPECT( mockObject->eContents ).returns( mockChildren );
+    MOCK_EXPECT( mockChild->eContents ).returns( emptyList );
+
+    m->registerObject( mockObject );
+
+    BOOST_CHECK_EQUAL( m->getID( mockObject ), "" );
+    BOOST_CHECK_EQUAL( m->getID( mockChild ), "id" );
+    BOOST_CHECK_EQUAL( m->getEObject( "id" ), mockChild );
+
+    m->unregisterObject( mockObject );
+    BOOST_CHECK_EQUAL( m->getEObject( "id" ), nullptr );
+}
+
 BOOST_AUTO_TEST_CASE( RegisterWithID )
 {
+    auto mockAdapters = std::make_shared<MockEList<EAdapter*>>();
+    MOCK_EXPECT( mockAdapters->add ).exactly( 3 ).returns( true );
+    MOCK_EXPECT( mockAdapters->removeObject ).exactly( 3 ).returns( true );
+
     auto m = std::make_unique<ResourceIDManager>();
 
-    auto mockObject = createMockEObject( "id" );
-    auto mockChild1 = createMockEObject( "id1" );
-    auto mockChild2 = createMockEObject( "id2" );
+    auto mockObject = createMockEObject( "id", *mockAdapters );
+    auto mockChild1 = createMockEObject( "id1", *mockAdapters );
+    auto mockChild2 = createMockEObject( "id2", *mockAdapters );
     auto mockChildren = std::make_shared<ImmutableArrayEList<std::shared_ptr<EObject>>>(
         std::initializer_list<std::shared_ptr<EObject>>{mockChild1, mockChild2} );
     auto emptyList = std::make_shared<ImmutableArrayEList<std::shared_ptr<EObject>>>();
@@ -93,11 +139,15 @@ BOOST_AUTO_TEST_CASE( RegisterWithID )
 
 BOOST_AUTO_TEST_CASE( UnRegisterWithID )
 {
+    auto mockAdapters = std::make_shared<MockEList<EAdapter*>>();
+    MOCK_EXPECT( mockAdapters->add ).exactly( 3 ).returns( true );
+    MOCK_EXPECT( mockAdapters->removeObject ).exactly( 3 ).returns( true );
+
     auto m = std::make_unique<ResourceIDManager>();
 
-    auto mockObject = createMockEObject( "id" );
-    auto mockChild1 = createMockEObject( "id1" );
-    auto mockChild2 = createMockEObject( "id2" );
+    auto mockObject = createMockEObject( "id", *mockAdapters );
+    auto mockChild1 = createMockEObject( "id1", *mockAdapters );
+    auto mockChild2 = createMockEObject( "id2", *mockAdapters );
     auto mockChildren = std::make_shared<ImmutableArrayEList<std::shared_ptr<EObject>>>(
         std::initializer_list<std::shared_ptr<EObject>>{mockChild1, mockChild2} );
     auto emptyList = std::make_shared<ImmutableArrayEList<std::shared_ptr<EObject>>>();
@@ -124,9 +174,6 @@ BOOST_AUTO_TEST_CASE( UnRegisterWithID )
     BOOST_CHECK_EQUAL( m->getEObject( "id" ), nullptr );
     BOOST_CHECK_EQUAL( m->getEObject( "id1" ), nullptr );
     BOOST_CHECK_EQUAL( m->getEObject( "id2" ), nullptr );
-
-
-
 }
 
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "ecore/impl/AbstractResource.hpp"
 #include "ecore/impl/ResourceSet.hpp"
+#include "ecore/tests/MockEList.hpp"
 #include "ecore/tests/MockEObject.hpp"
 #include "ecore/tests/MockEResource.hpp"
 #include "ecore/tests/MockEResourceFactory.hpp"
@@ -15,12 +16,21 @@ namespace
 {
     class Resource : public AbstractResource
     {
+    public:
+        Resource() = default;
+
+        Resource( const URI& uri )
+            : AbstractResource( uri )
+        {
+        }
+
+    private:
         // Inherited via AbstractResource
-        virtual void doLoad( std::istream& is ) override
+        virtual void doLoad( std::istream& is, const Options& options ) override
         {
             throw std::exception( "NotImplementedException " );
         }
-        virtual void doSave( std::ostream& os ) override
+        virtual void doSave( std::ostream& os, const Options& options ) override
         {
             throw std::exception( "NotImplementedException " );
         }
@@ -37,10 +47,16 @@ BOOST_AUTO_TEST_CASE( Constructor )
 
 BOOST_AUTO_TEST_CASE( Resources_WithMock )
 {
+    auto resource = std::make_shared<MockEResource>();
+    auto mockAdapters = std::make_shared<MockEList<EAdapter*>>();
+
     auto resourceSet = std::make_shared<ResourceSet>();
     resourceSet->setThisPtr( resourceSet );
 
-    auto resource = std::make_shared<MockEResource>();
+    MOCK_EXPECT( resource->getURI ).returns( URI() );
+    MOCK_EXPECT( resource->eAdapters ).returns( *mockAdapters );
+    MOCK_EXPECT( mockAdapters->add ).once().returns( true );
+    MOCK_EXPECT( mockAdapters->removeObject ).once().returns( true );
     auto resources = resourceSet->getResources();
     resources->add( resource );
 
@@ -68,6 +84,7 @@ BOOST_AUTO_TEST_CASE( CreateResource )
     auto mockResourceFactoryRegistry = std::make_shared<MockEResourceFactoryRegistry>();
     auto mockResourceFactory = std::make_shared<MockEResourceFactory>();
     auto mockResource = std::make_shared<MockEResource>();
+    auto mockAdapters = std::make_shared<MockEList<EAdapter*>>();
 
     auto resourceSet = std::make_shared<ResourceSet>();
     resourceSet->setThisPtr( resourceSet );
@@ -75,6 +92,10 @@ BOOST_AUTO_TEST_CASE( CreateResource )
 
     MOCK_EXPECT( mockResourceFactoryRegistry->getFactory ).with( uri ).returns( mockResourceFactory );
     MOCK_EXPECT( mockResourceFactory->createResource ).with( uri ).returns( mockResource );
+    MOCK_EXPECT( mockResource->getURI ).returns( uri );
+    MOCK_EXPECT( mockResource->eAdapters ).returns( *mockAdapters );
+    MOCK_EXPECT( mockAdapters->add ).once().returns( true );
+    MOCK_EXPECT( mockAdapters->removeObject ).once().returns( true );
     BOOST_CHECK_EQUAL( resourceSet->createResource( uri ), mockResource );
     BOOST_CHECK( resourceSet->getResources()->contains( mockResource ) );
 }
@@ -85,6 +106,7 @@ BOOST_AUTO_TEST_CASE( GetResource )
     auto mockResourceFactoryRegistry = std::make_shared<MockEResourceFactoryRegistry>();
     auto mockResourceFactory = std::make_shared<MockEResourceFactory>();
     auto mockResource = std::make_shared<MockEResource>();
+    auto mockAdapters = std::make_shared<MockEList<EAdapter*>>();
 
     auto resourceSet = std::make_shared<ResourceSet>();
     resourceSet->setThisPtr( resourceSet );
@@ -92,6 +114,10 @@ BOOST_AUTO_TEST_CASE( GetResource )
 
     MOCK_EXPECT( mockResourceFactoryRegistry->getFactory ).with( uri ).returns( mockResourceFactory );
     MOCK_EXPECT( mockResourceFactory->createResource ).with( uri ).returns( mockResource );
+    MOCK_EXPECT( mockResource->getURI ).returns( uri );
+    MOCK_EXPECT( mockResource->eAdapters ).returns( *mockAdapters );
+    MOCK_EXPECT( mockAdapters->add ).once().returns( true );
+    MOCK_EXPECT( mockAdapters->removeObject ).once().returns( true );
     MOCK_EXPECT( mockResource->loadSimple ).once();
 
     BOOST_CHECK_EQUAL( resourceSet->getResource( uri, true ), mockResource );
@@ -104,6 +130,7 @@ BOOST_AUTO_TEST_CASE( GetEObject )
     auto mockResourceFactory = std::make_shared<MockEResourceFactory>();
     auto mockResource = std::make_shared<MockEResource>();
     auto mockObject = std::make_shared<MockEObject>();
+    auto mockAdapters = std::make_shared<MockEList<EAdapter*>>();
 
     auto resourceSet = std::make_shared<ResourceSet>();
     resourceSet->setThisPtr( resourceSet );
@@ -111,10 +138,63 @@ BOOST_AUTO_TEST_CASE( GetEObject )
 
     MOCK_EXPECT( mockResourceFactoryRegistry->getFactory ).with( uri.trimFragment() ).returns( mockResourceFactory );
     MOCK_EXPECT( mockResourceFactory->createResource ).with( uri.trimFragment() ).returns( mockResource );
+    MOCK_EXPECT( mockResource->getURI ).returns( uri.trimFragment() );
+    MOCK_EXPECT( mockResource->eAdapters ).returns( *mockAdapters );
+    MOCK_EXPECT( mockAdapters->add ).once().returns( true );
+    MOCK_EXPECT( mockAdapters->removeObject ).once().returns( true );
     MOCK_EXPECT( mockResource->loadSimple ).once();
     MOCK_EXPECT( mockResource->getEObject ).with( uri.getFragment() ).returns( mockObject );
 
     BOOST_CHECK_EQUAL( resourceSet->getEObject( uri, true ), mockObject );
 }
 
+BOOST_AUTO_TEST_CASE( GetResource_Index )
+{
+    auto resourceSet = std::make_shared<ResourceSet>();
+    resourceSet->setThisPtr( resourceSet );
+
+    URI uri( "file://file.t" );
+    auto resource = std::make_shared<Resource>( uri );
+    resource->setThisPtr( resource );
+    resourceSet->getResources()->add( resource );
+    BOOST_CHECK_EQUAL( resourceSet->getResource( uri, false ), resource );
+
+    resourceSet->getResources()->remove( resource );
+    BOOST_CHECK_EQUAL( resourceSet->getResource( uri, false ), nullptr );
+}
+
+BOOST_AUTO_TEST_CASE( GetResource_Index_URIChanged )
+{
+    auto resourceSet = std::make_shared<ResourceSet>();
+    resourceSet->setThisPtr( resourceSet );
+
+    URI oldURI( "file://old.t" );
+    URI newURI( "file://new.t" );
+    auto resource = std::make_shared<Resource>( oldURI );
+    resource->setThisPtr( resource );
+    resourceSet->getResources()->add( resource );
+
+    resource->setURI( newURI );
+    BOOST_CHECK_EQUAL( resourceSet->getResource( oldURI, false ), nullptr );
+    BOOST_CHECK_EQUAL( resourceSet->getResource( newURI, false ), resource );
+}
+
+BOOST_AUTO_TEST_CASE( GetResource_Index_SameURI )
+{
+    auto resourceSet = std::make_shared<ResourceSet>();
+    resourceSet->setThisPtr( resourceSet );
+
+    URI uri( "file://file.t" );
+    auto resource1 = std::make_shared<Resource>( uri );
+    resource1->setThisPtr( resource1 );
+    auto resource2 = std::make_shared<Resource>( uri );
+    resource2->setThisPtr( resource2 );
+    resourceSet->getResources()->add( resource1 );
+    resourceSet->getResources()->add( resource2 );
+    BOOST_CHECK_EQUAL( resourceSet->getResource( uri, false ), resource1 );
+
+    resourceSet->getResources()->remove( resource1 );
+    BOOST_CHECK_EQUAL( resourceSet->getResource( uri, false ), resource2 );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
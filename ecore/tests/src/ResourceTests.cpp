@@ -19,11 +19,11 @@ namespace
     class Resource : public AbstractResource
     {
         // Inherited via AbstractResource
-        virtual void doLoad( std::istream& is ) override
+        virtual void doLoad( std::istream& is, const Options& options ) override
         {
             throw std::exception( "NotImplementedException " );
         }
-        virtual void doSave( std::ostream& os ) override
+        virtual void doSave( std::ostream& os, const Options& options ) override
         {
             throw std::exception( "NotImplementedException " );
         }
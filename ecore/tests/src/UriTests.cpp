@@ -3,8 +3,14 @@
 #include "ecore\Stream.hpp"
 #include "ecore\URI.hpp"
 
+#include <chrono>
+#include <iostream>
+
 using namespace ecore;
 
+#define NB_ITERATIONS 1000000
+#define LOG 1
+
 namespace std
 {
     template <typename T, typename U>
@@ -215,4 +221,50 @@ BOOST_AUTO_TEST_CASE( TrimFragment )
     }
 }
 
+BOOST_AUTO_TEST_CASE( Constructor_Authority )
+{
+    URI uri{"http://user:pass:word@[::1]:80/path"};
+    BOOST_CHECK_EQUAL( uri.getUsername(), "user" );
+    BOOST_CHECK_EQUAL( uri.getPassword(), "pass:word" );
+    BOOST_CHECK_EQUAL( uri.getHost(), "[::1]" );
+    BOOST_CHECK_EQUAL( uri.getHostName(), "::1" );
+    BOOST_CHECK_EQUAL( uri.getPort(), 80 );
+    BOOST_CHECK_EQUAL( uri.getPath(), "/path" );
+    BOOST_CHECK_EQUAL( uri.getAuthority(), "user:pass:word@[::1]:80" );
+}
+
+BOOST_AUTO_TEST_CASE( Constructor_InvalidAuthority )
+{
+    BOOST_CHECK_THROW( URI( "http://host:port/path" ), std::invalid_argument );
+    BOOST_CHECK_THROW( URI( "http://[::1/path" ), std::invalid_argument );
+}
+
+BOOST_AUTO_TEST_CASE( ToString )
+{
+    std::string str = "http://user@host:10020/path/path2?key1=foo#fragment";
+    URI uri{str};
+    BOOST_CHECK_EQUAL( uri.toString(), str );
+}
+
+BOOST_AUTO_TEST_CASE( Performance, *boost::unit_test::disabled() )
+{
+    std::vector<std::string> strs = { "http://host:10020/path/path2?key1=foo&key2=&key3&=bar&=bar=#fragment",
+                                      "file:/C:/data/library.xml#//@books.123/@authors.4",
+                                      "library.xml#//@books.123",
+                                      "#//@writers.1" };
+    auto start = std::chrono::steady_clock::now();
+    std::size_t nb = 0;
+    for( int i = 0; i < NB_ITERATIONS; ++i )
+    {
+        URI uri( strs[i % strs.size()] );
+        nb += uri.getPath().size();
+    }
+    auto end = std::chrono::steady_clock::now();
+    auto times = std::chrono::duration_cast<std::chrono::microseconds>( end - start ).count();
+    BOOST_CHECK( nb > 0 );
+#if LOG
+    std::cout << "Parse:" << (double)times / NB_ITERATIONS << " us" << std::endl;
+#endif
+}
+
 BOOST_AUTO_TEST_SUITE_END()
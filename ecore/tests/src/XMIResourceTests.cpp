@@ -1,18 +1,27 @@
 #include <boost/test/unit_test.hpp>
 
 #include "Memory.hpp"
+#include "ecore/AnyCast.hpp"
 #include "ecore/EAttribute.hpp"
 #include "ecore/EClass.hpp"
 #include "ecore/EClassifier.hpp"
+#include "ecore/EContentAdapter.hpp"
+#include "ecore/ECrossReferenceAdapter.hpp"
 #include "ecore/EDataType.hpp"
 #include "ecore/EDiagnostic.hpp"
+#include "ecore/EFactory.hpp"
+#include "ecore/EObject.hpp"
 #include "ecore/EPackage.hpp"
+#include "ecore/EPackageRegistry.hpp"
 #include "ecore/EReference.hpp"
 #include "ecore/EStructuralFeature.hpp"
+#include "ecore/EcoreFactory.hpp"
+#include "ecore/EcorePackage.hpp"
 #include "ecore/Stream.hpp"
 #include "ecore/impl/SaxParserPool.hpp"
 #include "ecore/impl/XMIResource.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <fstream>
 #include <streambuf>
@@ -24,6 +33,55 @@ using namespace ecore::impl;
 #define NB_ITERATIONS 8
 #define LOG 1
 
+namespace
+{
+    // generates a delta document of nbElements elements without keeping it in memory
+    // a document repeating an element between a start and an end, generated while it is read
+    class RepeatStreamBuf : public std::streambuf
+    {
+    public:
+        RepeatStreamBuf( const std::string& start, const std::string& element, const std::string& end, std::size_t nbElements )
+            : nbElements_( nbElements )
+            , end_( end )
+        {
+            for( std::size_t i = 0; i < CHUNK_SIZE; ++i )
+                chunk_ += element;
+            current_ = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n" + start;
+            setg( current_.data(), current_.data(), current_.data() + current_.size() );
+        }
+
+    protected:
+        int_type underflow() override
+        {
+            if( nbElements_ > 0 )
+            {
+                auto nb = std::min( nbElements_, CHUNK_SIZE );
+                current_.assign( chunk_, 0, nb * ( chunk_.size() / CHUNK_SIZE ) );
+                nbElements_ -= nb;
+            }
+            else if( !isEnd_ )
+            {
+                current_ = end_;
+                isEnd_ = true;
+            }
+            else
+                return traits_type::eof();
+
+            setg( current_.data(), current_.data(), current_.data() + current_.size() );
+            return traits_type::to_int_type( *gptr() );
+        }
+
+    private:
+        static constexpr std::size_t CHUNK_SIZE = 1024;
+        std::size_t nbElements_;
+        std::string end_;
+        std::string chunk_;
+        std::string current_;
+        bool isEnd_ = false;
+    };
+
+} // namespace
+
 BOOST_AUTO_TEST_SUITE( XMIResourceTests )
 
 BOOST_AUTO_TEST_CASE( Load_Simple )
@@ -129,6 +187,27 @@ BOOST_AUTO_TEST_CASE( Load_Complex )
     BOOST_CHECK_EQUAL( eTitleAttributeType->getName(), "EString" );
 }
 
+BOOST_AUTO_TEST_CASE( GetEObject )
+{
+    auto resource = std::make_shared<XMIResource>( URI( "data/library.ecore" ) );
+    resource->setThisPtr( resource );
+    resource->load();
+    BOOST_CHECK( resource->isLoaded() );
+
+    auto ePackage = std::dynamic_pointer_cast<EPackage>( resource->getContents()->get( 0 ) );
+    BOOST_REQUIRE( ePackage );
+    auto eBookClass = std::dynamic_pointer_cast<EClass>( ePackage->getEClassifier( "Book" ) );
+    BOOST_REQUIRE( eBookClass );
+    auto eTitleAttribute = eBookClass->getEAttributes()->get( 0 );
+
+    BOOST_CHECK_EQUAL( resource->getEObject( "/" ), ePackage );
+    BOOST_CHECK_EQUAL( resource->getEObject( "//Book" ), eBookClass );
+    BOOST_CHECK_EQUAL( resource->getEObject( "//Book/title" ), eTitleAttribute );
+    BOOST_CHECK_EQUAL( resource->getEObject( "//Book/unknown" ), nullptr );
+    BOOST_CHECK_EQUAL( resource->getEObject( "/1" ), nullptr );
+    BOOST_CHECK_EQUAL( resource->getEObject( resource->getURIFragment( eTitleAttribute ) ), eTitleAttribute );
+}
+
 namespace
 {
     std::string replaceAll( std::string str, const std::string& from, const std::string& to )
@@ -181,6 +260,232 @@ BOOST_AUTO_TEST_CASE( Save_Complex )
     BOOST_CHECK_EQUAL( replaceAll( ss.str(), "\r\n", "\n" ), replaceAll( expected, "\r\n", "\n" ) );
 }
 
+BOOST_AUTO_TEST_CASE( Save_Complex_NativeParser )
+{
+    auto resource = std::make_shared<XMIResource>( URI( "data/library.ecore" ) );
+    resource->setThisPtr( resource );
+    resource->setParser( XMLResource::Parser::NATIVE );
+    resource->load();
+
+    BOOST_CHECK( resource->isLoaded() );
+    BOOST_CHECK( resource->getWarnings()->empty() );
+    BOOST_CHECK( resource->getErrors()->empty() );
+
+    std::ifstream ifs( "data/library.ecore" );
+    std::string expected( ( std::istreambuf_iterator<char>( ifs ) ), std::istreambuf_iterator<char>() );
+
+    std::stringstream ss;
+    resource->save( ss );
+
+    BOOST_CHECK_EQUAL( replaceAll( ss.str(), "\r\n", "\n" ), replaceAll( expected, "\r\n", "\n" ) );
+}
+
+BOOST_AUTO_TEST_CASE( Save_Complex_Options )
+{
+    auto resource = std::make_shared<XMIResource>( URI( "data/library.ecore" ) );
+    resource->setThisPtr( resource );
+
+    EResource::Options loadOptions{{XMLResource::OPTION_PARSER, XMLResource::Parser::NATIVE}};
+    resource->load( loadOptions );
+
+    BOOST_CHECK( resource->isLoaded() );
+    BOOST_CHECK( resource->getWarnings()->empty() );
+    BOOST_CHECK( resource->getErrors()->empty() );
+
+    std::ifstream ifs( "data/library.ecore" );
+    std::string expected( ( std::istreambuf_iterator<char>( ifs ) ), std::istreambuf_iterator<char>() );
+
+    std::stringstream ss;
+    EResource::Options saveOptions{{XMLResource::OPTION_PARALLEL_SAVE, true}};
+    resource->save( ss, saveOptions );
+
+    BOOST_CHECK_EQUAL( replaceAll( ss.str(), "\r\n", "\n" ), replaceAll( expected, "\r\n", "\n" ) );
+}
+
+BOOST_AUTO_TEST_CASE( Load_NativeParser_Malformed )
+{
+    auto resource = std::make_shared<XMIResource>( URI( "malformed.ecore" ) );
+    resource->setThisPtr( resource );
+    resource->setParser( XMLResource::Parser::NATIVE );
+
+    std::stringstream ss;
+    ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+       << "<ecore:EPackage xmi:version=\"2.0\" xmlns:xmi=\"http://www.omg.org/XMI\"\n"
+       << "    xmlns:ecore=\"http://www.eclipse.org/emf/2002/Ecore\" name=\"p\">\n"
+       << "  <eClassifiers name=\"c\">\n"
+       << "</ecore:EPackage>\n";
+    resource->load( ss );
+
+    auto errors = resource->getErrors();
+    BOOST_REQUIRE_EQUAL( errors->size(), 1 );
+    BOOST_CHECK_EQUAL( errors->get( 0 )->getLine(), 5 );
+}
+
+namespace
+{
+    // counts the notifications of the objects, the ones of the resource are not counted
+    class CountingContentAdapter : public EContentAdapter
+    {
+    public:
+        virtual void notifyChanged( const std::shared_ptr<ENotification>& notification )
+        {
+            EContentAdapter::notifyChanged( notification );
+            if( std::dynamic_pointer_cast<EObject>( notification->getNotifier() ) )
+                ++count_;
+        }
+
+        int count_{0};
+    };
+} // namespace
+
+BOOST_AUTO_TEST_CASE( Load_DisableNotify )
+{
+    CountingContentAdapter adapter;
+    ECrossReferenceAdapter crossReferenceAdapter;
+    auto resource = std::make_shared<XMIResource>( URI( "data/library.ecore" ) );
+    resource->setThisPtr( resource );
+    resource->eAdapters().add( &adapter );
+    resource->eAdapters().add( &crossReferenceAdapter );
+
+    EResource::Options options{{XMLResource::OPTION_DISABLE_NOTIFY, true}};
+    resource->load( options );
+
+    BOOST_CHECK( resource->isLoaded() );
+    BOOST_CHECK( resource->getErrors()->empty() );
+    BOOST_CHECK_EQUAL( adapter.count_, 0 );
+
+    // loaded objects deliver again and are observed by the content adapter of the resource
+    auto ePackage = std::dynamic_pointer_cast<EPackage>( resource->getContents()->get( 0 ) );
+    BOOST_REQUIRE( ePackage );
+    auto eBookClass = std::dynamic_pointer_cast<EClass>( ePackage->getEClassifier( "Book" ) );
+    BOOST_REQUIRE( eBookClass );
+    auto eTitleAttribute = eBookClass->getEAttributes()->get( 0 );
+    BOOST_CHECK( ePackage->eDeliver() );
+    BOOST_CHECK( ePackage->eAdapters().contains( &adapter ) );
+    BOOST_CHECK( eBookClass->eDeliver() );
+    BOOST_CHECK( eBookClass->eAdapters().contains( &adapter ) );
+    BOOST_CHECK( eTitleAttribute->eDeliver() );
+    BOOST_CHECK( eTitleAttribute->eAdapters().contains( &adapter ) );
+
+    auto count = adapter.count_;
+    eTitleAttribute->setName( "name" );
+    BOOST_CHECK_EQUAL( adapter.count_, count + 1 );
+
+    // references resolved without notification are indexed
+    auto eWriterClass = ePackage->getEClassifier( "Writer" );
+    auto eAuthorReference = eBookClass->getEStructuralFeature( "author" );
+    BOOST_REQUIRE( eWriterClass );
+    BOOST_REQUIRE( eAuthorReference );
+    auto settings = crossReferenceAdapter.getInverseReferences( eWriterClass );
+    BOOST_CHECK( std::any_of( settings.begin(), settings.end(), [&]( const ECrossReferenceAdapter::Setting& setting ) {
+        return setting.first == eAuthorReference;
+    } ) );
+    BOOST_CHECK( crossReferenceAdapter.getInverseReferences( eBookClass ).size() > 0 );
+
+    resource->eAdapters().remove( &crossReferenceAdapter );
+    resource->eAdapters().remove( &adapter );
+}
+
+BOOST_AUTO_TEST_CASE( Load_InvalidOption )
+{
+    CountingContentAdapter adapter;
+    auto resource = std::make_shared<XMIResource>( URI( "data/library.ecore" ) );
+    resource->setThisPtr( resource );
+    resource->eAdapters().add( &adapter );
+
+    // an option of an unexpected type keeps its default value
+    EResource::Options options{{XMLResource::OPTION_DISABLE_NOTIFY, std::string( "true" )}};
+    BOOST_CHECK_NO_THROW( resource->load( options ) );
+
+    BOOST_CHECK( resource->isLoaded() );
+    BOOST_CHECK( resource->getErrors()->empty() );
+    BOOST_CHECK( adapter.count_ > 0 );
+
+    resource->eAdapters().remove( &adapter );
+}
+
+BOOST_AUTO_TEST_CASE( Load_BoundedMemory )
+{
+    auto ecoreFactory = EcoreFactory::eInstance();
+    auto ecorePackage = EcorePackage::eInstance();
+    auto eClass = ecoreFactory->createEClass();
+    eClass->setName( "C" );
+    auto eAttribute = ecoreFactory->createEAttribute();
+    eAttribute->setName( "a" );
+    eAttribute->setEType( ecorePackage->getEString() );
+    eClass->getEStructuralFeatures()->add( eAttribute );
+    auto eReference = ecoreFactory->createEReference();
+    eReference->setName( "x" );
+    eReference->setEType( eClass );
+    eReference->setContainment( true );
+    eClass->getEStructuralFeatures()->add( eReference );
+    auto ePackage = ecoreFactory->createEPackage();
+    ePackage->setName( "c" );
+    ePackage->setNsPrefix( "c" );
+    ePackage->setNsURI( "http://c" );
+    ePackage->setEFactoryInstance( ecoreFactory->createEFactory() );
+    ePackage->getEClassifiers()->add( eClass );
+    EPackageRegistry::getInstance()->registerPackage( ePackage );
+
+    auto resource = std::make_shared<XMIResource>( URI( "bounded.xmi" ) );
+    resource->setThisPtr( resource );
+
+    // each object replaces the previous one : the memory used by the load doesn't depend on the number of elements
+    SaxParserPool::getInstance();
+    auto currentSize = getCurrentRSS();
+    RepeatStreamBuf buf( "<c:C xmi:version=\"2.0\" xmlns:xmi=\"http://www.omg.org/XMI\" xmlns:c=\"http://c\">",
+                         "<x a=\"v\"/>",
+                         "</c:C>",
+                         1000000 );
+    std::istream is( &buf );
+    resource->load( is );
+
+    BOOST_CHECK( resource->getErrors()->empty() );
+    BOOST_REQUIRE_EQUAL( resource->getContents()->size(), 1 );
+    auto eObject = anyObjectCast<std::shared_ptr<EObject>>( resource->getContents()->get( 0 )->eGet( eReference ) );
+    BOOST_REQUIRE( eObject );
+    BOOST_CHECK_EQUAL( anyCast<std::string>( eObject->eGet( eAttribute ) ), "v" );
+    BOOST_CHECK_LT( getCurrentRSS(), currentSize + 64 * 1024 * 1024 );
+
+    EPackageRegistry::getInstance()->unregisterPackage( ePackage );
+}
+
+BOOST_AUTO_TEST_CASE( Load_BoundedMemory_Delta, *boost::unit_test::disabled() )
+{
+    auto ecoreFactory = EcoreFactory::eInstance();
+    auto ecorePackage = EcorePackage::eInstance();
+    auto eAttribute = ecoreFactory->createEAttribute();
+    eAttribute->setName( "a" );
+    eAttribute->setEType( ecorePackage->getEString() );
+    auto eClass = ecoreFactory->createEClass();
+    eClass->setName( "C" );
+    eClass->getEStructuralFeatures()->add( eAttribute );
+    auto ePackage = ecoreFactory->createEPackage();
+    ePackage->setName( "c" );
+    ePackage->setNsPrefix( "c" );
+    ePackage->setNsURI( "http://c" );
+    ePackage->setEFactoryInstance( ecoreFactory->createEFactory() );
+    ePackage->getEClassifiers()->add( eClass );
+
+    auto resource = std::make_shared<XMIResource>( URI( "bounded.xmi" ) );
+    resource->setThisPtr( resource );
+    resource->getContents()->add( ePackage->getEFactoryInstance()->create( eClass ) );
+
+    // the memory used by a load depends on the depth of the document, not on its number of elements
+    SaxParserPool::getInstance();
+    auto currentSize = getCurrentRSS();
+    RepeatStreamBuf buf( "<delta:Delta xmlns:delta=\"http://www.masagroup.net/ecore/delta\">",
+                         "<c delta:fragment=\"/\" a=\"v\"/>",
+                         "</delta:Delta>",
+                         10000000 );
+    std::istream is( &buf );
+    resource->loadDelta( is );
+
+    BOOST_CHECK( resource->getErrors()->empty() );
+    BOOST_CHECK_EQUAL( anyCast<std::string>( resource->getContents()->get( 0 )->eGet( eAttribute ) ), "v" );
+    BOOST_CHECK_LT( getCurrentRSS(), currentSize + 64 * 1024 * 1024 );
+}
+
 BOOST_AUTO_TEST_CASE( Performance, *boost::unit_test::disabled() )
 {
     SaxParserPool::getInstance();
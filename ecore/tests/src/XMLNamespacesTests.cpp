@@ -2,6 +2,8 @@
 
 #include "ecore/impl/XMLNamespaces.hpp"
 
+#include <iterator>
+
 using namespace ecore;
 using namespace ecore::impl;
 
@@ -73,4 +75,31 @@ BOOST_AUTO_TEST_CASE( Context_NoRemap )
     BOOST_CHECK( namespaces.getPrefix( "uri2" ) == "prefix" );
 }
 
+BOOST_AUTO_TEST_CASE( Context_Shadowed )
+{
+    XMLNamespaces namespaces;
+    namespaces.pushContext();
+    BOOST_CHECK( !namespaces.declarePrefix( "prefix", "uri" ) );
+    BOOST_CHECK( !namespaces.declarePrefix( "prefix2", "uri2" ) );
+
+    namespaces.pushContext();
+    BOOST_CHECK( !namespaces.declarePrefix( "prefix", "uri2" ) );
+    BOOST_CHECK( !namespaces.declarePrefix( "prefix3", "uri" ) );
+    BOOST_CHECK( namespaces.getURI( "prefix" ) == "uri2" );
+    BOOST_CHECK( namespaces.getPrefix( "uri" ) == "prefix3" );
+    BOOST_CHECK( namespaces.getPrefix( "uri2" ) == "prefix" );
+
+    BOOST_CHECK( namespaces.declarePrefix( "prefix3", "uri3" ) );
+    BOOST_CHECK( namespaces.getPrefix( "uri" ) == "prefix" );
+    BOOST_CHECK( namespaces.getPrefix( "uri3" ) == "prefix3" );
+
+    auto c = namespaces.popContext();
+    BOOST_CHECK_EQUAL( std::distance( c.begin(), c.end() ), 2 );
+    BOOST_CHECK( namespaces.getURI( "prefix" ) == "uri" );
+    BOOST_CHECK( namespaces.getURI( "prefix3" ).empty() );
+    BOOST_CHECK( namespaces.getPrefix( "uri" ) == "prefix" );
+    BOOST_CHECK( namespaces.getPrefix( "uri2" ) == "prefix2" );
+    BOOST_CHECK( namespaces.getPrefix( "uri3" ).empty() );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
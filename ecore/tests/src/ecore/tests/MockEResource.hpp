@@ -33,14 +33,32 @@ namespace ecore::tests
         MOCK_METHOD( detached, 1 )
         MOCK_METHOD_EXT( load, 0, void(), loadSimple )
         MOCK_METHOD_EXT( load, 1, void( std::istream& ), loadFromStream )
+        MOCK_METHOD_EXT( load, 1, void( const EResource::Options& ), loadWithOptions )
+        MOCK_METHOD_EXT( load, 2, void( std::istream&, const EResource::Options& ), loadFromStreamWithOptions )
         MOCK_METHOD( unload, 0 )
         MOCK_METHOD( isLoaded, 0 )
+        MOCK_METHOD( isLoadOnDemand, 0 )
+        MOCK_METHOD( setLoadOnDemand, 1 )
+        MOCK_METHOD( isLoadPending, 0 )
         MOCK_METHOD_EXT( save, 0, void(), saveSimple )
         MOCK_METHOD_EXT( save, 1, void( std::ostream& ), saveToStream )
+        MOCK_METHOD_EXT( save, 1, void( const EResource::Options& ), saveWithOptions )
+        MOCK_METHOD_EXT( save, 2, void( std::ostream&, const EResource::Options& ), saveToStreamWithOptions )
+        MOCK_METHOD_EXT( loadDelta, 1, void( std::istream& ), loadDelta )
+        MOCK_METHOD_EXT( loadDelta, 2, void( std::istream&, const EResource::Options& ), loadDeltaWithOptions )
+        MOCK_METHOD_EXT( saveDelta, 1, void( std::ostream& ), saveDelta )
+        MOCK_METHOD_EXT( saveDelta, 2, void( std::ostream&, const EResource::Options& ), saveDeltaWithOptions )
+        MOCK_METHOD( isTrackingModification, 0 )
+        MOCK_METHOD( setTrackingModification, 1 )
+        MOCK_METHOD( isModified, 0 )
         MOCK_METHOD( getErrors, 0 )
         MOCK_METHOD( getWarnings, 0 )
         MOCK_METHOD( getIDManager, 0)
         MOCK_METHOD( setIDManager, 1 )
+        MOCK_METHOD( getTypeIndex, 0 )
+        MOCK_METHOD( setTypeIndex, 1 )
+        MOCK_METHOD( getStatistics, 0 )
+        MOCK_METHOD( setStatistics, 1 )
     };
 
     typedef MockEResourceBase<EResource> MockEResource;
@@ -0,0 +1,64 @@
+// *****************************************************************************
+//
+// This file is part of a MASA library or program.
+// Refer to the included end-user license agreement for restrictions.
+//
+// Copyright (c) 2020 MASA Group
+//
+// *****************************************************************************
+
+#ifndef LIBRARY_BENCHMARKS_BENCHMARK_HPP
+#define LIBRARY_BENCHMARKS_BENCHMARK_HPP
+
+#include "Memory.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+
+namespace library::benchmarks
+{
+    // allocations counted by the global operator new of the benchmarks executable
+    struct Allocations
+    {
+        std::size_t count_;
+        std::size_t bytes_;
+    };
+
+    Allocations getAllocations();
+
+    struct Measure
+    {
+        std::string name_;
+        std::size_t size_;
+        std::chrono::nanoseconds duration_;
+        Allocations allocations_;
+        std::size_t peakRSS_;
+    };
+
+    void writeHeader( std::ostream& os );
+
+    void write( std::ostream& os, const Measure& measure );
+
+    template <typename F>
+    Measure measure( const std::string& name, std::size_t size, F f )
+    {
+        auto before = getAllocations();
+        auto start = std::chrono::steady_clock::now();
+        f();
+        auto end = std::chrono::steady_clock::now();
+        auto after = getAllocations();
+        return Measure{ name,
+                        size,
+                        std::chrono::duration_cast<std::chrono::nanoseconds>( end - start ),
+                        Allocations{ after.count_ - before.count_, after.bytes_ - before.bytes_ },
+                        getPeakRSS() };
+    }
+
+    // runs all the benchmarks on a library of about size objects
+    void runLibraryBenchmarks( std::size_t size, std::ostream& os );
+
+} // namespace library::benchmarks
+
+#endif
@@ -0,0 +1,119 @@
+#include "Benchmark.hpp"
+
+#include "library/Library.hpp"
+#include "library/LibraryFactory.hpp"
+#include "library/LibraryPackage.hpp"
+#include "library/tests/LibraryFactory.hpp"
+
+#include "ecore/AnyCast.hpp"
+#include "ecore/EAttribute.hpp"
+#include "ecore/EClass.hpp"
+#include "ecore/ECollectionView.hpp"
+#include "ecore/EList.hpp"
+#include "ecore/EPackageRegistry.hpp"
+#include "ecore/EResource.hpp"
+#include "ecore/EcoreUtils.hpp"
+#include "ecore/URI.hpp"
+#include "ecore/impl/AbstractResource.hpp"
+#include "ecore/impl/EObjectInternal.hpp"
+#include "ecore/impl/ResourceSet.hpp"
+#include "ecore/impl/XMIResourceFactory.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+using namespace ecore;
+using namespace ecore::impl;
+using namespace library;
+using namespace library::benchmarks;
+
+namespace
+{
+    // a library of size objects : one tenth are writers, one hundredth employees and the others books
+    std::shared_ptr<Library> createLibrary( std::size_t size )
+    {
+        auto nbWriters = static_cast<int>( size / 10 );
+        auto nbEmployees = static_cast<int>( size / 100 );
+        auto nbBooks = static_cast<int>( size ) - nbWriters - nbEmployees - 1;
+        return tests::LibraryFactory::createLibrary( nbEmployees, nbWriters, std::max( nbBooks, 0 ), 0 );
+    }
+
+    std::shared_ptr<EResource> createResource( const std::shared_ptr<ResourceSet>& resourceSet, const std::string& uri )
+    {
+        auto resource = XMIResourceFactory().createResource( URI( uri ) );
+        resourceSet->getResources()->add( resource );
+        return resource;
+    }
+
+} // namespace
+
+void library::benchmarks::runLibraryBenchmarks( std::size_t size, std::ostream& os )
+{
+    EPackageRegistry::getInstance()->registerPackage( LibraryPackage::eInstance() );
+
+    auto resourceSet = std::make_shared<ResourceSet>();
+    resourceSet->setThisPtr( resourceSet );
+
+    std::shared_ptr<Library> library;
+    write( os, measure( "create", size, [&]() { library = createLibrary( size ); } ) );
+
+    std::size_t nbObjects = 0;
+    write( os, measure( "eAllContents", size, [&]() {
+               for( const auto& eObject : *library->eAllContents() )
+                   ++nbObjects;
+           } ) );
+
+    write( os, measure( "reflective get/set", size, [&]() {
+               for( const auto& eObject : *library->eAllContents() )
+               {
+                   for( const auto& eAttribute : *eObject->eClass()->getEAllAttributes() )
+                   {
+                       auto value = eObject->eGet( eAttribute );
+                       if( eAttribute->isChangeable() && !eAttribute->isMany() && !eAttribute->isDerived() )
+                           eObject->eSet( eAttribute, value );
+                   }
+               }
+           } ) );
+
+    std::shared_ptr<EObject> copy;
+    write( os, measure( "deep copy", size, [&]() { copy = EcoreUtils::copy( library ); } ) );
+
+    write( os, measure( "deep equal", size, [&]() { auto _ = EcoreUtils::equals( library, copy ); } ) );
+    copy.reset();
+
+    auto saved = createResource( resourceSet, "saved.xmi" );
+    saved->getContents()->add( library );
+    std::stringstream ss;
+    write( os, measure( "xmi save", size, [&]() { saved->save( ss ); } ) );
+    saved->unload();
+    library.reset();
+
+    auto loaded = createResource( resourceSet, "loaded.xmi" );
+    write( os, measure( "xmi load", size, [&]() { loaded->load( ss ); } ) );
+
+    // proxies to all the objects of the loaded resource
+    std::vector<std::shared_ptr<EObject>> proxies;
+    if( auto abstractResource = std::dynamic_pointer_cast<AbstractResource>( loaded ) )
+    {
+        auto fragments = abstractResource->getURIFragments();
+        proxies.reserve( fragments.size() );
+        for( const auto& eObject : *loaded->getAllContents() )
+        {
+            auto proxy = LibraryFactory::eInstance()->create( eObject->eClass() );
+            URI uri( "loaded.xmi" );
+            uri.setFragment( fragments[eObject.get()] );
+            proxy->getInternal().eSetProxyURI( uri );
+            proxies.push_back( proxy );
+        }
+    }
+    write( os, measure( "proxy resolution", size, [&]() {
+               for( const auto& proxy : proxies )
+                   auto _ = EcoreUtils::resolve( proxy, resourceSet );
+           } ) );
+    proxies.clear();
+
+    write( os, measure( "unload", size, [&]() { loaded->unload(); } ) );
+
+    resourceSet->getResources()->clear();
+}
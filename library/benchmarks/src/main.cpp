@@ -0,0 +1,70 @@
+#include "Benchmark.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+using namespace library::benchmarks;
+
+namespace
+{
+    std::atomic<std::size_t> allocationCount{ 0 };
+    std::atomic<std::size_t> allocatedBytes{ 0 };
+
+    // sizes used when none is given on the command line, 10M objects needs several GB
+    const std::vector<std::size_t> defaultSizes = { 1000, 10000, 100000, 1000000 };
+
+} // namespace
+
+void* operator new( std::size_t size )
+{
+    allocationCount.fetch_add( 1, std::memory_order_relaxed );
+    allocatedBytes.fetch_add( size, std::memory_order_relaxed );
+    if( auto p = std::malloc( size ? size : 1 ) )
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete( void* p ) noexcept
+{
+    std::free( p );
+}
+
+void operator delete( void* p, std::size_t ) noexcept
+{
+    std::free( p );
+}
+
+Allocations library::benchmarks::getAllocations()
+{
+    return Allocations{ allocationCount.load( std::memory_order_relaxed ), allocatedBytes.load( std::memory_order_relaxed ) };
+}
+
+void library::benchmarks::writeHeader( std::ostream& os )
+{
+    os << "benchmark,objects,time_ms,allocations,allocated_bytes,peak_rss" << std::endl;
+}
+
+void library::benchmarks::write( std::ostream& os, const Measure& measure )
+{
+    os << measure.name_ << "," << measure.size_ << "," << std::chrono::duration<double, std::milli>( measure.duration_ ).count() << ","
+       << measure.allocations_.count_ << "," << measure.allocations_.bytes_ << "," << measure.peakRSS_ << std::endl;
+}
+
+// usage : ecore.benchmarks [size...]
+int main( int argc, char* argv[] )
+{
+    std::vector<std::size_t> sizes;
+    for( int i = 1; i < argc; ++i )
+        sizes.push_back( std::stoull( argv[i] ) );
+    if( sizes.empty() )
+        sizes = defaultSizes;
+
+    writeHeader( std::cout );
+    for( auto size : sizes )
+        runLibraryBenchmarks( size, std::cout );
+    return 0;
+}
@@ -0,0 +1,127 @@
+#include <boost/test/unit_test.hpp>
+
+#include "ecore/EChangeRecorder.hpp"
+#include "ecore/EList.hpp"
+#include "ecore/EcoreUtils.hpp"
+#include "library/Book.hpp"
+#include "library/Library.hpp"
+#include "library/LibraryFactory.hpp"
+#include "library/LibraryPackage.hpp"
+#include "library/Writer.hpp"
+#include "library/tests/LibraryFactory.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+using namespace ecore;
+using namespace library;
+using namespace library::tests;
+
+namespace
+{
+    constexpr int nb_writers = 10;
+    constexpr int nb_books = 100;
+
+    void modify( const std::shared_ptr<Library>& l )
+    {
+        auto b0 = l->getBooks()->get( 0 );
+        b0->setTitle( "First Title" );
+        b0->setTitle( "Other Title" );
+        b0->setAuthor( l->getWriters()->get( 1 ) );
+
+        auto b = library::LibraryFactory::eInstance()->createBook();
+        b->setTitle( "New Title" );
+        b->setAuthor( l->getWriters()->get( 0 ) );
+        l->getBooks()->add( 0, b );
+
+        l->getBooks()->remove( l->getBooks()->get( 10 ) );
+        l->getBooks()->move( 5, 20 );
+        l->getWriters()->get( 2 )->getBooks()->clear();
+    }
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE( ChangeRecorderTests )
+
+BOOST_AUTO_TEST_CASE( RollbackAndApply )
+{
+    auto l = tests::LibraryFactory::createLibrary( 0, nb_writers, nb_books, 0 );
+    auto before = EcoreUtils::copy( l );
+
+    EChangeRecorder recorder;
+    l->eAdapters().add( &recorder );
+    modify( l );
+    auto after = EcoreUtils::copy( l );
+    BOOST_CHECK( !EcoreUtils::equals( l, before ) );
+    BOOST_CHECK( recorder.getChangeCount() > 0 );
+
+    recorder.rollback();
+    BOOST_CHECK( EcoreUtils::equals( l, before ) );
+
+    recorder.apply();
+    BOOST_CHECK( EcoreUtils::equals( l, after ) );
+
+    l->eAdapters().remove( &recorder );
+}
+
+BOOST_AUTO_TEST_CASE( MergeAndSave )
+{
+    auto l = tests::LibraryFactory::createLibrary( 0, nb_writers, nb_books, 0 );
+    auto b = l->getBooks()->get( 0 );
+
+    EChangeRecorder recorder;
+    l->eAdapters().add( &recorder );
+
+    // successive sets of the same feature are recorded once
+    b->setTitle( "First Title" );
+    b->setTitle( "Other Title" );
+    BOOST_CHECK_EQUAL( recorder.getChangeCount(), 1 );
+
+    // a bidirectional reference change is recorded once
+    b->setAuthor( l->getWriters()->get( 1 ) );
+    BOOST_CHECK_EQUAL( recorder.getChangeCount(), 2 );
+
+    std::ostringstream os;
+    recorder.save( os );
+    auto s = os.str();
+    BOOST_CHECK_EQUAL( std::count( s.begin(), s.end(), '\n' ), 2 );
+    BOOST_CHECK( s.find( "Other Title" ) != std::string::npos );
+    BOOST_CHECK( s.find( "First Title" ) == std::string::npos );
+
+    // changes recorded after a rollback replace the reverted ones
+    recorder.rollback();
+    BOOST_CHECK_EQUAL( b->getTitle(), "Title 0" );
+    b->setTitle( "New Title" );
+    BOOST_CHECK_EQUAL( recorder.getChangeCount(), 1 );
+
+    recorder.clear();
+    BOOST_CHECK_EQUAL( recorder.getChangeCount(), 0 );
+
+    l->eAdapters().remove( &recorder );
+}
+
+BOOST_AUTO_TEST_CASE( Rollback_Unset )
+{
+    auto l = tests::LibraryFactory::createLibrary( 0, nb_writers, nb_books, 0 );
+    auto b = library::LibraryFactory::eInstance()->createBook();
+    l->getBooks()->add( b );
+    auto categoryAttribute = LibraryPackage::eInstance()->getBook_Category();
+    BOOST_CHECK( !b->eIsSet( categoryAttribute ) );
+
+    EChangeRecorder recorder;
+    l->eAdapters().add( &recorder );
+
+    // an unsettable feature which was not set is unset again
+    b->setCategory( BookCategory( 2 ) );
+    BOOST_CHECK( b->eIsSet( categoryAttribute ) );
+    recorder.rollback();
+    BOOST_CHECK( !b->eIsSet( categoryAttribute ) );
+
+    recorder.apply();
+    BOOST_CHECK( b->eIsSet( categoryAttribute ) );
+    BOOST_CHECK( b->getCategory() == BookCategory( 2 ) );
+
+    l->eAdapters().remove( &recorder );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
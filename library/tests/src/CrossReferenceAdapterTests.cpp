@@ -0,0 +1,108 @@
+#include <boost/test/unit_test.hpp>
+
+#include "ecore/ECrossReferenceAdapter.hpp"
+#include "ecore/EList.hpp"
+#include "ecore/EResource.hpp"
+#include "ecore/URI.hpp"
+#include "ecore/impl/ResourceSet.hpp"
+#include "library/Book.hpp"
+#include "library/Library.hpp"
+#include "library/LibraryPackage.hpp"
+#include "library/Writer.hpp"
+#include "library/tests/LibraryFactory.hpp"
+
+using namespace ecore;
+using namespace library;
+using namespace library::tests;
+
+namespace
+{
+    constexpr int nb_writers = 10;
+    constexpr int nb_books = 100;
+
+    // books of l written by w, as computed by a scan
+    std::size_t countBooks( const std::shared_ptr<Library>& l, const std::shared_ptr<Writer>& w )
+    {
+        std::size_t count = 0;
+        for( const auto& b : *l->getBooks() )
+        {
+            if( b->getAuthor() == w )
+                ++count;
+        }
+        return count;
+    }
+
+    // inverse references of w through Book.author
+    std::size_t countAuthorReferences( const std::vector<ECrossReferenceAdapter::Setting>& settings )
+    {
+        auto authorReference = LibraryPackage::eInstance()->getBook_Author();
+        std::size_t count = 0;
+        for( const auto& [eSource, eReference] : settings )
+        {
+            if( eReference == authorReference )
+                ++count;
+        }
+        return count;
+    }
+} // namespace
+
+BOOST_AUTO_TEST_SUITE( CrossReferenceAdapterTests )
+
+BOOST_AUTO_TEST_CASE( InverseReferences )
+{
+    auto l = LibraryFactory::createLibrary( 0, nb_writers, nb_books, 0 );
+
+    ECrossReferenceAdapter adapter;
+    l->eAdapters().add( &adapter );
+
+    for( const auto& w : *l->getWriters() )
+        BOOST_CHECK_EQUAL( countAuthorReferences( adapter.getInverseReferences( w ) ), countBooks( l, w ) );
+
+    // index is updated when a reference changes
+    auto w0 = l->getWriters()->get( 0 );
+    auto w1 = l->getWriters()->get( 1 );
+    auto b = l->getBooks()->get( 0 );
+    b->setAuthor( w0 );
+    b->setAuthor( w1 );
+    BOOST_CHECK_EQUAL( countAuthorReferences( adapter.getInverseReferences( w0 ) ), countBooks( l, w0 ) );
+    BOOST_CHECK_EQUAL( countAuthorReferences( adapter.getInverseReferences( w1 ) ), countBooks( l, w1 ) );
+
+    // index is updated when a referencing object is removed
+    l->getBooks()->remove( b );
+    BOOST_CHECK_EQUAL( countAuthorReferences( adapter.getInverseReferences( w1 ) ), countBooks( l, w1 ) );
+
+    l->eAdapters().remove( &adapter );
+    BOOST_CHECK( !adapter.getTarget() );
+    BOOST_CHECK( adapter.getInverseReferences( w1 ).empty() );
+}
+
+BOOST_AUTO_TEST_CASE( Usages )
+{
+    auto resourceSet = std::make_shared<ecore::impl::ResourceSet>();
+    resourceSet->setThisPtr( resourceSet );
+    auto resource = resourceSet->createResource( URI( "file:lib.xml" ) );
+    BOOST_REQUIRE( resource );
+
+    auto l = LibraryFactory::createLibrary( 0, nb_writers, nb_books, 0 );
+    resource->getContents()->add( l );
+
+    // without index : resources are scanned
+    auto w = l->getWriters()->get( 0 );
+    BOOST_CHECK_EQUAL( countAuthorReferences( ECrossReferenceAdapter::getUsages( w, resourceSet ) ), countBooks( l, w ) );
+
+    // with index installed on the resource set
+    ECrossReferenceAdapter adapter;
+    resourceSet->eAdapters().add( &adapter );
+    BOOST_CHECK_EQUAL( countAuthorReferences( ECrossReferenceAdapter::getUsages( w, resourceSet ) ), countBooks( l, w ) );
+
+    // objects added afterwards are indexed
+    auto l2 = LibraryFactory::createLibrary( 0, nb_writers, nb_books, 0 );
+    auto b = l2->getBooks()->get( 0 );
+    resource->getContents()->add( l2 );
+    b->setAuthor( w );
+    BOOST_CHECK_EQUAL( countAuthorReferences( ECrossReferenceAdapter::getUsages( w, resourceSet ) ), countBooks( l, w ) + 1 );
+
+    resourceSet->eAdapters().remove( &adapter );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,6 +1,12 @@
 #include <boost/test/unit_test.hpp>
 
+#include "ecore/EList.hpp"
+#include "ecore/EResource.hpp"
+#include "ecore/EResourceFactory.hpp"
+#include "ecore/EResourceFactoryRegistry.hpp"
 #include "ecore/EcoreUtils.hpp"
+#include "ecore/URI.hpp"
+#include "library/Book.hpp"
 #include "library/tests/LibraryFactory.hpp"
 
 using namespace ecore;
@@ -25,4 +31,36 @@ BOOST_AUTO_TEST_CASE( DeepCopyAndEquals )
     BOOST_CHECK( EcoreUtils::equals( l, lbis ) );
 }
 
+BOOST_AUTO_TEST_CASE( DeepCopyAndNotEquals )
+{
+    auto l = LibraryFactory::createLibrary( nb_employees, nb_writers, nb_books, nb_borrowers );
+    auto lbis = EcoreUtils::copy( l );
+    auto book = std::dynamic_pointer_cast<Library>( lbis )->getBooks()->get( nb_books - 1 );
+    book->setTitle( "Other Title" );
+    BOOST_CHECK( !EcoreUtils::equals( l, lbis ) );
+}
+
+BOOST_AUTO_TEST_CASE( DeepEqualsResources )
+{
+    auto createResource = []( const URI& uri ) {
+        auto resourceFactory = EResourceFactoryRegistry::getInstance()->getFactory( uri );
+        return resourceFactory->createResource( uri );
+    };
+    auto resource = createResource( URI( "file:lib.xml" ) );
+    auto resourceBis = createResource( URI( "file:libbis.xml" ) );
+    for( int i = 0; i < 4; ++i )
+    {
+        auto l = LibraryFactory::createLibrary( nb_employees, nb_writers, nb_books, nb_borrowers );
+        resource->getContents()->add( l );
+        resourceBis->getContents()->add( EcoreUtils::copy( l ) );
+    }
+    BOOST_CHECK( EcoreUtils::equals( resource, resourceBis ) );
+    BOOST_CHECK( EcoreUtils::equals( resource, resourceBis, true ) );
+
+    auto lbis = std::dynamic_pointer_cast<Library>( resourceBis->getContents()->get( 2 ) );
+    lbis->getBooks()->get( 0 )->setTitle( "Other Title" );
+    BOOST_CHECK( !EcoreUtils::equals( resource, resourceBis ) );
+    BOOST_CHECK( !EcoreUtils::equals( resource, resourceBis, true ) );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -1,17 +1,28 @@
 #include <boost/test/unit_test.hpp>
 
+#include "library/Book.hpp"
+#include "library/Library.hpp"
+#include "library/LibraryFactory.hpp"
 #include "library/LibraryPackage.hpp"
+#include "library/Writer.hpp"
 #include "library/tests/LibraryFactory.hpp"
 
+#include "ecore/ECollectionView.hpp"
+#include "ecore/ECrossReferenceAdapter.hpp"
 #include "ecore/EResource.hpp"
 #include "ecore/EDiagnostic.hpp"
 #include "ecore/EResourceFactory.hpp"
 #include "ecore/EResourceFactoryRegistry.hpp"
 #include "ecore/EPackageRegistry.hpp"
 #include "ecore/URI.hpp"
+#include "ecore/impl/AbstractResource.hpp"
+#include "ecore/impl/EObjectInternal.hpp"
+#include "ecore/impl/ResourceStatistics.hpp"
+#include "ecore/impl/XMLResource.hpp"
 
 #include <fstream>
 #include <filesystem>
+#include <sstream>
 
 using namespace ecore;
 using namespace library;
@@ -30,7 +41,7 @@ BOOST_AUTO_TEST_SUITE( SerializationTests )
 
 BOOST_AUTO_TEST_CASE( GenerateModel, *boost::unit_test::disabled() )
 {
-    auto l = LibraryFactory::createLibrary( nb_employees, nb_writers, nb_books, nb_borrowers );
+    auto l = tests::LibraryFactory::createLibrary( nb_employees, nb_writers, nb_books, nb_borrowers );
     auto fileURI = URI( "file:" + std::filesystem::temp_directory_path().string() +  "/mylib.xml" );
     auto resourceFactory = EResourceFactoryRegistry::getInstance()->getFactory( fileURI );
     BOOST_CHECK( resourceFactory );
@@ -78,4 +89,287 @@ BOOST_AUTO_TEST_CASE( LoadSave )
     BOOST_CHECK_EQUAL( replaceAll( ss.str(), "\r\n", "\n" ), replaceAll( expected, "\r\n", "\n" ) );
 }
 
+BOOST_AUTO_TEST_CASE( LoadOnDemand )
+{
+    EPackageRegistry::getInstance()->registerPackage( LibraryPackage::eInstance() );
+
+    auto fileURI = URI( "data/library.xml" );
+    auto resourceFactory = EResourceFactoryRegistry::getInstance()->getFactory( fileURI );
+    BOOST_CHECK( resourceFactory );
+    auto resource = resourceFactory->createResource( fileURI );
+    BOOST_REQUIRE( resource );
+    resource->setLoadOnDemand( true );
+    resource->load();
+    BOOST_CHECK( resource->isLoaded() );
+
+    // contents are loaded when first accessed
+    auto eObject = resource->getEObject( "//@books.0" );
+    BOOST_CHECK( eObject );
+    BOOST_CHECK_EQUAL( resource->getContents()->size(), 1 );
+    BOOST_CHECK( resource->getErrors()->empty() );
+
+    std::ifstream ifs( "data/library.xml" );
+    std::string expected( ( std::istreambuf_iterator<char>( ifs ) ), std::istreambuf_iterator<char>() );
+
+    std::stringstream ss;
+    resource->save( ss );
+    BOOST_CHECK_EQUAL( replaceAll( ss.str(), "\r\n", "\n" ), replaceAll( expected, "\r\n", "\n" ) );
+
+    // unloading a resource whose contents were not accessed
+    resource->unload();
+    resource->load();
+    resource->unload();
+    BOOST_CHECK( !resource->isLoaded() );
+    BOOST_CHECK( resource->getContents()->empty() );
+}
+
+BOOST_AUTO_TEST_CASE( LoadOnDemand_ContentAdapter )
+{
+    EPackageRegistry::getInstance()->registerPackage( LibraryPackage::eInstance() );
+
+    auto fileURI = URI( "data/library.xml" );
+    auto resourceFactory = EResourceFactoryRegistry::getInstance()->getFactory( fileURI );
+    BOOST_CHECK( resourceFactory );
+    auto resource = resourceFactory->createResource( fileURI );
+    BOOST_REQUIRE( resource );
+    resource->setLoadOnDemand( true );
+    resource->load();
+
+    // adapting the resource doesn't parse it
+    ECrossReferenceAdapter adapter;
+    resource->eAdapters().add( &adapter );
+    resource->setTrackingModification( true );
+    BOOST_CHECK( resource->isLoadPending() );
+
+    // contents are adapted when loaded
+    BOOST_REQUIRE_EQUAL( resource->getContents()->size(), 1 );
+    BOOST_CHECK( !resource->isLoadPending() );
+    auto eObject = resource->getEObject( "//@books.0" );
+    BOOST_REQUIRE( eObject );
+    BOOST_CHECK( eObject->eAdapters().contains( &adapter ) );
+
+    resource->eAdapters().remove( &adapter );
+}
+
+BOOST_AUTO_TEST_CASE( Unload )
+{
+    EPackageRegistry::getInstance()->registerPackage( LibraryPackage::eInstance() );
+
+    auto fileURI = URI( "data/library.xml" );
+    auto resourceFactory = EResourceFactoryRegistry::getInstance()->getFactory( fileURI );
+    BOOST_CHECK( resourceFactory );
+    auto resource = resourceFactory->createResource( fileURI );
+    BOOST_REQUIRE( resource );
+    resource->load();
+    BOOST_CHECK( resource->isLoaded() );
+
+    auto eObject = resource->getEObject( "//@books.1" );
+    BOOST_REQUIRE( eObject );
+    BOOST_CHECK( !eObject->eIsProxy() );
+
+    // objects still referenced after the unload are proxies to their former uri
+    resource->unload();
+    BOOST_CHECK( !resource->isLoaded() );
+    BOOST_CHECK( resource->getContents()->empty() );
+    BOOST_CHECK( eObject->eIsProxy() );
+    BOOST_CHECK( eObject->eAdapters().empty() );
+    BOOST_CHECK( eObject->eDeliver() );
+    BOOST_CHECK_EQUAL( eObject->getInternal().eProxyURI().toString(), "data/library.xml#//@books.1" );
+
+    resource->load();
+    auto eLoaded = resource->getEObject( eObject->getInternal().eProxyURI().getFragment() );
+    BOOST_CHECK( eLoaded );
+    BOOST_CHECK( eLoaded != eObject );
+    BOOST_CHECK( !eLoaded->eIsProxy() );
+}
+
+BOOST_AUTO_TEST_CASE( URIFragments )
+{
+    EPackageRegistry::getInstance()->registerPackage( LibraryPackage::eInstance() );
+
+    auto fileURI = URI( "data/library.xml" );
+    auto resourceFactory = EResourceFactoryRegistry::getInstance()->getFactory( fileURI );
+    BOOST_CHECK( resourceFactory );
+    auto resource = std::dynamic_pointer_cast<ecore::impl::AbstractResource>( resourceFactory->createResource( fileURI ) );
+    BOOST_REQUIRE( resource );
+    resource->load();
+    BOOST_CHECK( resource->isLoaded() );
+
+    auto fragments = resource->getURIFragments();
+    std::size_t nbObjects = 0;
+    for( auto eObject : *resource->getAllContents() )
+    {
+        auto it = fragments.find( eObject.get() );
+        BOOST_REQUIRE( it != fragments.end() );
+        BOOST_CHECK_EQUAL( it->second, resource->getURIFragment( eObject ) );
+        ++nbObjects;
+    }
+    BOOST_CHECK_EQUAL( fragments.size(), nbObjects );
+}
+
+BOOST_AUTO_TEST_CASE( SaveDelta )
+{
+    EPackageRegistry::getInstance()->registerPackage( LibraryPackage::eInstance() );
+
+    auto fileURI = URI( "data/library.xml" );
+    auto resourceFactory = EResourceFactoryRegistry::getInstance()->getFactory( fileURI );
+    BOOST_CHECK( resourceFactory );
+    auto resource = resourceFactory->createResource( fileURI );
+    BOOST_REQUIRE( resource );
+    resource->setTrackingModification( true );
+    resource->load();
+    BOOST_CHECK( !resource->isModified() );
+
+    auto copy = resourceFactory->createResource( fileURI );
+    BOOST_REQUIRE( copy );
+    copy->load();
+
+    auto l = std::dynamic_pointer_cast<Library>( resource->getContents()->get( 0 ) );
+    BOOST_REQUIRE( l );
+    BOOST_REQUIRE( l->getBooks()->size() > 1 && l->getWriters()->size() > 1 );
+
+    // features changes : only the modified objects are written
+    auto b = l->getBooks()->get( 1 );
+    b->setTitle( "Other Title" );
+    b->setAuthor( l->getWriters()->get( b->getAuthor() == l->getWriters()->get( 0 ) ? 1 : 0 ) );
+    BOOST_CHECK( resource->isModified() );
+
+    std::stringstream delta;
+    resource->saveDelta( delta );
+    BOOST_CHECK( !resource->isModified() );
+
+    std::stringstream saved;
+    resource->save( saved );
+    BOOST_CHECK( delta.str().size() < saved.str().size() / 2 );
+
+    copy->loadDelta( delta );
+    BOOST_CHECK( copy->getErrors()->empty() );
+
+    std::stringstream copySaved;
+    copy->save( copySaved );
+    BOOST_CHECK_EQUAL( copySaved.str(), saved.str() );
+
+    // contents changes : the modified contents and the objects referencing them are written
+    auto nb = library::LibraryFactory::eInstance()->createBook();
+    nb->setTitle( "New Title" );
+    nb->setAuthor( l->getWriters()->get( 0 ) );
+    l->getBooks()->add( 0, nb );
+
+    delta.str( "" );
+    resource->saveDelta( delta );
+    copy->loadDelta( delta );
+    BOOST_CHECK( copy->getErrors()->empty() );
+
+    saved.str( "" );
+    resource->save( saved );
+    copySaved.str( "" );
+    copy->save( copySaved );
+    BOOST_CHECK_EQUAL( copySaved.str(), saved.str() );
+}
+
+BOOST_AUTO_TEST_CASE( Statistics )
+{
+    EPackageRegistry::getInstance()->registerPackage( LibraryPackage::eInstance() );
+
+    auto fileURI = URI( "data/library.xml" );
+    auto resourceFactory = EResourceFactoryRegistry::getInstance()->getFactory( fileURI );
+    BOOST_CHECK( resourceFactory );
+    auto resource = resourceFactory->createResource( fileURI );
+    BOOST_REQUIRE( resource );
+    auto statistics = std::make_shared<ecore::impl::ResourceStatistics>();
+    resource->setStatistics( statistics );
+    resource->load();
+    BOOST_CHECK( resource->isLoaded() );
+
+    std::size_t nbObjects = 0;
+    for( auto eObject : *resource->getAllContents() )
+        ++nbObjects;
+
+    auto library = std::dynamic_pointer_cast<Library>( resource->getContents()->get( 0 ) );
+    BOOST_REQUIRE( library );
+    BOOST_CHECK_EQUAL( statistics->getElementCount(), nbObjects );
+    BOOST_CHECK_EQUAL( statistics->getObjectCount(), nbObjects );
+    BOOST_CHECK_EQUAL( statistics->getObjectCount( LibraryPackage::eInstance()->getBook() ), library->getBooks()->size() );
+    BOOST_CHECK( statistics->getAttributeConversionCount() > 0 );
+    BOOST_CHECK( statistics->getResolvedReferenceCount() > 0 );
+    BOOST_CHECK_EQUAL( statistics->getProxyCount(), 0 );
+    BOOST_CHECK( statistics->getBytesRead() > 0 );
+    BOOST_CHECK( statistics->getDuration( EResourceStatistics::Phase::PARSE ).count() > 0 );
+
+    std::stringstream ss;
+    resource->save( ss );
+    BOOST_CHECK_EQUAL( statistics->getBytesWritten(), ss.str().size() );
+
+    std::stringstream json;
+    statistics->save( json );
+    BOOST_CHECK( json.str().find( "{\"class\":\"Book\",\"count\":" ) != std::string::npos );
+
+    // a resource without statistics does not report anything
+    statistics->clear();
+    resource->setStatistics( nullptr );
+    resource->save( ss );
+    BOOST_CHECK_EQUAL( statistics->getBytesWritten(), 0 );
+}
+
+BOOST_AUTO_TEST_CASE( ForwardReferences )
+{
+    EPackageRegistry::getInstance()->registerPackage( LibraryPackage::eInstance() );
+
+    auto fileURI = URI( "data/forward.xml" );
+    auto resourceFactory = EResourceFactoryRegistry::getInstance()->getFactory( fileURI );
+    BOOST_CHECK( resourceFactory );
+    auto resource = resourceFactory->createResource( fileURI );
+    BOOST_REQUIRE( resource );
+
+    // books of the writer are read before and after it : they keep the order of its ids
+    std::stringstream ss;
+    ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+       << "<lib:Library xmlns:lib=\"http:///org/eclipse/emf/examples/library/library.ecore/1.0.0\" name=\"My Library\">\n"
+       << "  <books title=\"Title 0\"/>\n"
+       << "  <writers firstName=\"First Name 0\" books=\"#//@books.1 #//@books.0 #//@books.2\"/>\n"
+       << "  <books title=\"Title 1\"/>\n"
+       << "  <books title=\"Title 2\"/>\n"
+       << "</lib:Library>\n";
+    resource->load( ss );
+    BOOST_CHECK( resource->getErrors()->empty() );
+
+    auto l = std::dynamic_pointer_cast<Library>( resource->getContents()->get( 0 ) );
+    BOOST_REQUIRE( l );
+    BOOST_REQUIRE_EQUAL( l->getBooks()->size(), 3 );
+    BOOST_REQUIRE_EQUAL( l->getWriters()->size(), 1 );
+    auto books = l->getWriters()->get( 0 )->getBooks();
+    BOOST_REQUIRE_EQUAL( books->size(), 3 );
+    BOOST_CHECK_EQUAL( books->get( 0 ), l->getBooks()->get( 1 ) );
+    BOOST_CHECK_EQUAL( books->get( 1 ), l->getBooks()->get( 0 ) );
+    BOOST_CHECK_EQUAL( books->get( 2 ), l->getBooks()->get( 2 ) );
+    for( const auto& b : *l->getBooks() )
+        BOOST_CHECK_EQUAL( b->getAuthor(), l->getWriters()->get( 0 ) );
+}
+
+BOOST_AUTO_TEST_CASE( ParallelSave )
+{
+    EPackageRegistry::getInstance()->registerPackage( LibraryPackage::eInstance() );
+
+    auto l = tests::LibraryFactory::createLibrary( nb_employees, nb_writers, nb_books, nb_borrowers );
+    auto fileURI = URI( "data/parallel.xml" );
+    auto resourceFactory = EResourceFactoryRegistry::getInstance()->getFactory( fileURI );
+    BOOST_CHECK( resourceFactory );
+    auto resource = std::dynamic_pointer_cast<ecore::impl::XMLResource>( resourceFactory->createResource( fileURI ) );
+    BOOST_REQUIRE( resource );
+    resource->getContents()->add( l );
+    auto statistics = std::make_shared<ecore::impl::ResourceStatistics>();
+    resource->setStatistics( statistics );
+
+    std::stringstream sequential;
+    resource->save( sequential );
+    auto nbConversions = statistics->getAttributeConversionCount();
+
+    statistics->clear();
+    resource->setParallelSave( true );
+    std::stringstream parallel;
+    resource->save( parallel );
+    BOOST_CHECK_EQUAL( parallel.str(), sequential.str() );
+    BOOST_CHECK_EQUAL( statistics->getAttributeConversionCount(), nbConversions );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file